@@ -3,8 +3,25 @@
 
 #include<iostream>
 #include<vector>
+#include<cstring>
+#include<memory>
 
 #include "string.h"
+#include "chunkedstring.h"
+#include "linereader.h"
+#include "outputbatch.h"
+#include "stringtable.h"
+#include "stringvector.h"
+#include "stringmap.h"
+#include "stringtrie.h"
+#include "stringsort.h"
+#include "patternmatcher.h"
+#include "literalswitch.h"
+#include "format.h"
+#include "stringstream.h"
+#include "transcode.h"
+#include "binarytext.h"
+#include "parallel.h"
 #include "test.h"
 
 
@@ -46,7 +63,7 @@ void stringTests() {
 		auto asciiLength = sizeof(cstr);
 		String s(ptr);
 		test.expect(s.isEmpty())->toBeFalse();
-		test.expect(s.bufferCapacity())->toBe(64);
+		test.expect(s.bufferCapacity())->toBeInside(64, 128); // Allocator slack is kept as capacity
 		test.expect(s.bufferSize())->toBe(asciiLength);
 		test.expect(s.length())->toBe(asciiLength - 1);
 		test.expect(StringIntrospection(s).isSmall())->toBeFalse();
@@ -57,6 +74,50 @@ void stringTests() {
 	});
 
 
+	test.test("Long string buffer is aligned and keeps allocator slack", [&] {
+		const char* ptr = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+		String s(ptr);
+		auto capacity = s.bufferCapacity();
+		test.expect((u64)s.cString() % Memory::BufferAlignment)->toBeZero();
+
+		// Appending up to the reported capacity must not reallocate
+		auto oldPtr = s.cString();
+		while (s.bufferSize() < capacity) {
+			s.append("x");
+		}
+		test.expect(s.bufferCapacity())->toBe(capacity);
+		test.expect(s.cString() == oldPtr)->toBeTrue();
+	});
+
+
+	test.test("Huge string grows in mapped memory", [&] {
+		std::vector<char> block(4096, 'a');
+		block.back() = '\0';
+
+		String s;
+		while (s.bufferSize() < 1024 * 1024) {
+			s.append(block.data());
+		}
+		test.expect(StringIntrospection(s).hasMappedBuffer())->toBeFalse();
+
+		while (s.bufferSize() < 12 * 1024 * 1024) {
+			s.append(block.data());
+		}
+		test.expect(StringIntrospection(s).hasMappedBuffer())->toBeTrue();
+		test.expect(s.length())->toBe(s.bufferSize() - 1);
+
+		// Copies still share the mapped buffer until one of them is written to
+		String s2 = s;
+		test.expect(StringIntrospection(s2).isShared())->toBeTrue();
+		s2.append("b");
+		test.expect(StringIntrospection(s).mode())->toBe(StringIntrospection::Mode::Owned);
+		test.expect(StringIntrospection(s2).hasMappedBuffer())->toBeTrue();
+		test.expect(s2.bufferSize())->toBe(s.bufferSize() + 1);
+		test.expect(s2.cString()[s2.bufferSize() - 2] == 'b')->toBeTrue();
+		test.expect(s.cString()[s.bufferSize() - 2] == 'a')->toBeTrue();
+	});
+
+
 	test.test("Small string construction from array (compile time length)", [&] {
 		char cstr[] = "abcdefgh";
 		const char* ptr = cstr;
@@ -138,13 +199,13 @@ void stringTests() {
 		String s2 = s;
 
 		test.expect(s.isEmpty())->toBeFalse();
-		test.expect(s.bufferCapacity())->toBe(64);
+		test.expect(s.bufferCapacity())->toBeInside(64, 128); // Allocator slack is kept as capacity
 		test.expect(s.bufferSize())->toBe(asciiLength);
 		test.expect(s.length())->toBe(asciiLength - 1);
 		test.expect(StringIntrospection(s).isShared())->toBeTrue();
 
 		test.expect(s2.isEmpty())->toBeFalse();
-		test.expect(s2.bufferCapacity())->toBe(64);
+		test.expect(s2.bufferCapacity())->toBe(s.bufferCapacity());
 		test.expect(s2.bufferSize())->toBe(asciiLength);
 		test.expect(s2.length())->toBe(asciiLength - 1);
 		test.expect(StringIntrospection(s2).isShared())->toBeTrue();
@@ -193,6 +254,948 @@ void stringTests() {
 		test.expect(StringIntrospection(s).mode())->toBe(StringIntrospection::Mode::Owned);
 	});
 
+	test.test("Remove prefix and prepend into the headroom", [&] {
+		const char* ptr = "Header: abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+		String s(ptr);
+		auto length = s.length();
+		auto oldPtr = s.cString();
+
+		s.removePrefix(8);
+		test.expect(s.cString() == oldPtr + 8)->toBeTrue();
+		test.expect(s.length())->toBe(length - 8);
+		test.expect(strcmp(s.cString(), ptr + 8))->toBeZero();
+
+		s.prepend("Other: ");
+		test.expect(s.cString() == oldPtr + 1)->toBeTrue();
+		test.expect(s.length())->toBe(length - 1);
+		test.expect(strcmp(s.cString(), "Other: abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ"))->toBeZero();
+
+		// Shared strings only move their start and leave the buffer untouched
+		String s2 = s;
+		s2.removePrefix(7);
+		test.expect(StringIntrospection(s2).isShared())->toBeTrue();
+		test.expect(strcmp(s2.cString(), ptr + 8))->toBeZero();
+		test.expect(strcmp(s.cString(), "Other: abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ"))->toBeZero();
+
+		// Prepending to a shared string copies it into a buffer with headroom
+		s2.prepend(s);
+		test.expect(StringIntrospection(s2).mode())->toBe(StringIntrospection::Mode::Owned);
+		test.expect(s2.bufferSize())->toBe(s.bufferSize() * 2 - 8);
+		oldPtr = s2.cString();
+		s2.prepend("!");
+		test.expect(s2.cString() == oldPtr - 1)->toBeTrue();
+		test.expect(s2.length())->toBe(s2.bufferSize() - 1);
+	});
+
+
+	test.test("Remove prefix of small and literal strings", [&] {
+		String s = "\xc3\xa4" "bc";
+		s.removePrefix(1);
+		test.expect(strcmp(s.cString(), "bc"))->toBeZero();
+		test.expect(s.length())->toBe(2);
+		s.prepend("\xc3\xa4");
+		test.expect(strcmp(s.cString(), "\xc3\xa4" "bc"))->toBeZero();
+		test.expect(StringIntrospection(s).isSmall())->toBeTrue();
+
+		String l = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+		l.removePrefix(26);
+		test.expect(StringIntrospection(l).isLiteral())->toBeTrue();
+		test.expect(strcmp(l.cString(), "ABCDEFGHIJKLMNOPQRSTUVWXYZ"))->toBeZero();
+		test.expect(l.length())->toBe(26);
+		l.removePrefix(100);
+		test.expect(l.isEmpty())->toBeTrue();
+	});
+
+
+	test.test("File backed string construction", [&] {
+		const char* path = "cowstrings_file_test.txt";
+		const char content[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ\n0123456789";
+		auto file = fopen(path, "wb");
+		fwrite(content, 1, sizeof(content) - 1, file);
+		fclose(file);
+
+		{
+			auto s = String::fromFile(path);
+			test.expect(s.has_value())->toBeTrue();
+			test.expect(StringIntrospection(*s).mode())->toBe(StringIntrospection::Mode::File);
+			test.expect(s->bufferSize())->toBe(sizeof(content));
+			test.expect(s->length())->toBe(sizeof(content) - 1);
+			test.expect(strcmp(s->cString(), content))->toBeZero();
+
+			// Copies share the mapping, a write copies the contents into an owned buffer
+			String s2 = *s;
+			test.expect(s2.cString() == s->cString())->toBeTrue();
+			s2.append("!");
+			test.expect(StringIntrospection(s2).mode())->toBe(StringIntrospection::Mode::Owned);
+			test.expect(StringIntrospection(*s).mode())->toBe(StringIntrospection::Mode::File);
+			test.expect(s2.bufferSize())->toBe(sizeof(content) + 1);
+			test.expect(strncmp(s2.cString(), content, sizeof(content) - 1))->toBeZero();
+		}
+
+		remove(path);
+		test.expect(String::fromFile(path).has_value())->toBeFalse();
+	});
+
+
+	test.test("Read lines sharing the chunk buffer", [&] {
+		const char* path = "cowstrings_lines_test.txt";
+		std::vector<char> hugeLine(3 * LineReader::TChunkSize / 2, 'x');
+		const char* longLine = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+		auto file = fopen(path, "wb");
+		fprintf(file, "short\n%s\n\n", longLine);
+		fwrite(hugeLine.data(), 1, hugeLine.size(), file);
+		fprintf(file, "\n%s\nlast", longLine);
+		fclose(file);
+
+		file = fopen(path, "rb");
+		LineReader reader(file);
+		String line, line2;
+		test.expect(reader.readLine(line))->toBeTrue();
+		test.expect(strcmp(line.cString(), "short"))->toBeZero();
+		test.expect(StringIntrospection(line).isSmall())->toBeTrue();
+
+		test.expect(reader.readLine(line2))->toBeTrue();
+		test.expect(strcmp(line2.cString(), longLine))->toBeZero();
+		test.expect(StringIntrospection(line2).isShared())->toBeTrue();
+		test.expect(line2.length())->toBe(strlen(longLine));
+
+		test.expect(reader.readLine(line))->toBeTrue();
+		test.expect(line.isEmpty())->toBeTrue();
+
+		// Lines crossing the end of a chunk are moved into the next one
+		test.expect(reader.readLine(line))->toBeTrue();
+		test.expect(line.bufferSize())->toBe(hugeLine.size() + 1);
+		test.expect(line.cString()[hugeLine.size() - 1] == 'x')->toBeTrue();
+
+		// Reusing the capacity of an owned string does not reference the chunk
+		test.expect(StringIntrospection(line).isShared())->toBeTrue();
+		line.reserve();
+		auto oldPtr = line.cString();
+		test.expect(reader.readLine(line, true))->toBeTrue();
+		test.expect(strcmp(line.cString(), longLine))->toBeZero();
+		test.expect(line.cString() == oldPtr)->toBeTrue();
+		test.expect(StringIntrospection(line).mode())->toBe(StringIntrospection::Mode::Owned);
+
+		test.expect(reader.readLine(line))->toBeTrue();
+		test.expect(strcmp(line.cString(), "last"))->toBeZero();
+		test.expect(reader.readLine(line))->toBeFalse();
+
+		fclose(file);
+		remove(path);
+	});
+
+
+	test.test("Reuse the chunk once no line references it", [&] {
+		const char* path = "cowstrings_reuse_test.txt";
+		std::string longLine(100, 'y');
+		auto file = fopen(path, "wb");
+		for (u64 i = 0; i != 3 * LineReader::TChunkSize / longLine.size(); i++) {
+			fprintf(file, "%s\n", longLine.c_str());
+		}
+		fclose(file);
+
+		// Every refill moves the data back into the same chunk
+		file = fopen(path, "rb");
+		LineReader reader(file);
+		String line;
+		test.expect(reader.readLine(line))->toBeTrue();
+		auto chunkBegin = line.cString();
+		u64 numLines = 1;
+		bool sameChunk = true;
+		while (reader.readLine(line)) {
+			sameChunk = sameChunk && line.cString() >= chunkBegin && line.cString() < chunkBegin + LineReader::TChunkSize;
+			numLines++;
+		}
+		test.expect(sameChunk)->toBeTrue();
+		test.expect(numLines)->toBe(3 * LineReader::TChunkSize / longLine.size());
+
+		fclose(file);
+		remove(path);
+	});
+
+
+	test.test("Write strings as a batch without concatenation", [&] {
+		const char* path = "cowstrings_batch_test.txt";
+		String owned("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ", {});
+		String expected = owned;
+		expected.append("Hello, ").append("world!\n").append(owned);
+
+		OutputBatch batch;
+		{
+			String temp(owned.cString());
+			batch.add(owned).add("Hello, ").add(String("world!\n")).add(std::move(temp));
+		}
+		test.expect(batch.pieceCount())->toBe(4);
+		test.expect(batch.byteCount())->toBe(expected.bufferSize() - 1);
+		test.expect(StringIntrospection(owned).isShared())->toBeTrue();
+
+		auto file = fopen(path, "w+b");
+		test.expect(batch.writeTo(fileno(file)))->toBeTrue();
+		test.expect(batch.writeTo(fileno(file), 0))->toBeTrue();
+		batch.clear();
+		test.expect(StringIntrospection(owned).isShared())->toBeFalse();
+
+		std::vector<char> content(2 * expected.bufferSize());
+		fseek(file, 0, SEEK_SET);
+		auto cnt = fread(content.data(), 1, content.size(), file);
+		fclose(file);
+		remove(path);
+
+		test.expect(cnt)->toBe(expected.bufferSize() - 1);
+		test.expect(memcmp(content.data(), expected.cString(), cnt))->toBeZero();
+	});
+
+
+	test.test("Load a string table as literal strings", [&] {
+		const char* path = "cowstrings_table_test.bin";
+		std::vector<String> strings;
+		strings.push_back("short");
+		strings.push_back(String("\xf0\x9f\xa5\x9d abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ", {}));
+		strings.push_back(String());
+		test.expect(StringTable::write(path, strings))->toBeTrue();
+
+		{
+			auto table = StringTable::load(path);
+			test.expect(table.has_value())->toBeTrue();
+			test.expect(table->size())->toBe(3);
+
+			for (u64 i = 0; i != strings.size(); i++) {
+				auto s = table->at(i);
+				test.expect(StringIntrospection(s).isLiteral())->toBeTrue();
+				test.expect(StringIntrospection(s).hasCachedCodePoints())->toBeTrue();
+				test.expect(s.bufferSize())->toBe(strings[i].bufferSize());
+				test.expect(s.length())->toBe(strings[i].length());
+				test.expect(strcmp(s.cString(), strings[i].cString()))->toBeZero();
+				test.expect(table->hashAt(i))->toBe(strings[i].hash());
+			}
+		}
+
+		// The payload is only checked when an entry is taken out of the table
+		auto file = fopen(path, "r+b");
+		fseek(file, 40 + 5, SEEK_SET);
+		fputc('!', file);
+		fclose(file);
+		{
+			auto table = StringTable::load(path);
+			test.expect(table.has_value())->toBeTrue();
+			test.expect(table->at(0).bufferSize())->toBe(1);
+			test.expect(table->at(1).length())->toBe(strings[1].length());
+		}
+
+		// A changed index or entries pointing past the payload are rejected
+		u64 indexOffset, value = 1;
+		file = fopen(path, "r+b");
+		fseek(file, 16, SEEK_SET);
+		fread(&indexOffset, sizeof(u64), 1, file);
+		fseek(file, (long)(indexOffset + 32 + 16), SEEK_SET);
+		fwrite(&value, sizeof(u64), 1, file);
+		fclose(file);
+		test.expect(StringTable::load(path).has_value())->toBeFalse();
+
+		value = 1000;
+		file = fopen(path, "r+b");
+		fseek(file, (long)(indexOffset + 32 + 8), SEEK_SET);
+		fwrite(&value, sizeof(u64), 1, file);
+		fclose(file);
+		test.expect(StringTable::load(path).has_value())->toBeFalse();
+
+		remove(path);
+		test.expect(StringTable::load(path).has_value())->toBeFalse();
+	});
+
+
+	test.test("String vector stores strings in one arena", [&] {
+		StringVector v(true, true);
+		String longString("\xf0\x9f\xa5\x9d abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ", {});
+		v.append("abc").append(longString).append("");
+		test.expect(v.size())->toBe(3);
+		test.expect(v.byteCount())->toBe(4 + longString.bufferSize() + 1);
+
+		auto s = v.at(1);
+		test.expect(StringIntrospection(s).isShared())->toBeTrue();
+		test.expect(StringIntrospection(s).hasCachedCodePoints())->toBeTrue();
+		test.expect(s.length())->toBe(longString.length());
+		test.expect(s.cString() == v.cStringAt(1))->toBeTrue();
+		test.expect(v.viewAt(1) == StringView(longString))->toBeTrue();
+		test.expect(v.hashAt(1))->toBe(longString.hash());
+		auto small = v.at(0);
+		test.expect(StringIntrospection(small).isSmall())->toBeTrue();
+		test.expect(v.viewAt(2).isEmpty())->toBeTrue();
+
+		// Taken strings stay valid when the arena is replaced while growing
+		std::vector<String> strings(1000, longString);
+		v.appendAll(strings);
+		test.expect(v.size())->toBe(1003);
+		test.expect(strcmp(s.cString(), longString.cString()))->toBeZero();
+
+		StringVector w;
+		w.append("x").append(v);
+		test.expect(w.size())->toBe(1004);
+		test.expect(w.lengthAt(2))->toBe(longString.length());
+		test.expect(strcmp(w.cStringAt(1), "abc"))->toBeZero();
+		test.expect(w.hashAt(1003))->toBe(longString.hash());
+	});
+
+
+	test.test("String map finds keys of every mode", [&] {
+		StringMap<int> map;
+		String literal = "a literal key which does not fit into a small string";
+		test.expect(StringIntrospection(literal).isLiteral())->toBeTrue();
+		map.insert(literal, 1);
+		map.insert("small", 2);
+		map["small"] += 10;
+		test.expect(map.size())->toBe(2);
+		test.expect(*map.find(literal))->toBe(1);
+		test.expect(*map.find("small"))->toBe(12);
+		test.expect(*map.find(StringView("small key", 5)))->toBe(12);
+		test.expect(*map.find(String("a literal key which does not fit into a small string", {})))->toBe(1);
+		test.expect(map.contains("smal"))->toBeFalse();
+
+		// Grow through many rehashes and remove every other key again
+		for (int i = 0; i != 1000; i++) {
+			String key("key ");
+			key.append(std::to_string(i).c_str());
+			map.insert(key, i);
+		}
+		for (int i = 0; i < 1000; i += 2) {
+			test.expect(map.erase(("key " + std::to_string(i)).c_str()))->toBeTrue();
+		}
+		test.expect(map.size())->toBe(502);
+		test.expect(map.contains("key 998"))->toBeFalse();
+		test.expect(*map.find("key 999"))->toBe(999);
+
+		int sum = 0;
+		map.forEach([&](const String&, int v) { sum += v; });
+		test.expect(sum)->toBe(250000 + 13);
+	});
+
+
+	test.test("String trie matches prefixes", [&] {
+		StringTrie<int> trie;
+		test.expect(trie.insert("/api", 1))->toBeTrue();
+		test.expect(trie.insert("/api/users", 2))->toBeTrue();
+		test.expect(trie.insert("/api/user/settings/notifications/email", 3))->toBeTrue();
+		test.expect(trie.insert("/about", 4))->toBeTrue();
+		test.expect(trie.insert("/api", 5))->toBeFalse();
+		for (int i = 0; i != 40; i++) {
+			String key("/x");
+			key.append(std::string(1, (char)('0' + i)).c_str());
+			trie.insert(key, 100 + i);
+		}
+		test.expect(trie.size())->toBe(44);
+
+		test.expect(*trie.find("/api"))->toBe(5);
+		test.expect(trie.find("/ap") == nullptr)->toBeTrue();
+		test.expect(*trie.find("/api/user/settings/notifications/email"))->toBe(3);
+		test.expect(*trie.find("/xW"))->toBe(139);
+
+		u64 matched;
+		test.expect(*trie.longestPrefixOf("/api/users/17", &matched))->toBe(2);
+		test.expect(matched)->toBe(10);
+		test.expect(*trie.longestPrefixOf("/api/user/17"))->toBe(5);
+		test.expect(trie.longestPrefixOf("/help") == nullptr)->toBeTrue();
+
+		int sum = 0, count = 0;
+		trie.forEachWithPrefix("/api/u", [&](const String&, int v) { sum += v; count++; });
+		test.expect(count)->toBe(2);
+		test.expect(sum)->toBe(5);
+	});
+
+
+	test.test("Sort strings by bytes", [&] {
+		// Many strings with long common prefixes and duplicates
+		std::vector<String> strings;
+		u64 seed = 12345;
+		for (int i = 0; i != 70000; i++) {
+			seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+			std::string s = (seed >> 60) & 1 ? "common prefix of more than eight bytes " : "";
+			s += std::to_string((seed >> 33) % 5000);
+			s += (seed >> 62) ? "\xc3\xa4" : "z";
+			strings.push_back(String(s.c_str()));
+		}
+
+		auto expected = strings;
+		std::sort(expected.begin(), expected.end(), [](const String& a, const String& b) {
+			return strcmp(a.cString(), b.cString()) < 0;
+		});
+
+		auto sorted = strings;
+		StringSort::sort(sorted);
+		test.expect(sorted == expected)->toBeTrue();
+
+		StringSort::sort(strings, true);
+		test.expect(strings == expected)->toBeTrue();
+	});
+
+
+	test.test("Find many patterns in one pass", [&] {
+		String text("\xc3\xa4 she sells sea shells by the sea shore, \xc3\xa4 he said to his sister");
+
+		PatternMatcher small({ "he", "she", "sea", "\xc3\xa4 " });
+		test.expect(small.usesAutomaton())->toBeFalse();
+		auto matches = small.findAll(text, true);
+		test.expect(matches.size())->toBe(10);
+		test.expect(matches[0].pattern)->toBe(3);
+		test.expect(matches[1].pattern)->toBe(1);
+		test.expect(matches[1].byteOffset)->toBe(3);
+		test.expect(matches[1].codePointOffset)->toBe(2);
+		test.expect(matches[2].byteOffset)->toBe(4);
+
+		// Empty patterns keep the indices of the patterns after them
+		PatternMatcher withEmpty({ "", "he", "", "she" });
+		matches = withEmpty.findAll(text);
+		test.expect(withEmpty.patternCount())->toBe(4);
+		test.expect(matches.size())->toBe(6);
+		test.expect(matches[0].pattern)->toBe(3);
+		test.expect(matches[1].pattern)->toBe(1);
+
+		// The automaton has to find the same matches as a naive search
+		std::vector<String> patterns;
+		for (int i = 0; i != 100; i++) {
+			patterns.push_back(String(std::to_string(i * 7).c_str()));
+		}
+		patterns.insert(patterns.begin() + 50, String());
+		patterns.push_back("he");
+		patterns.push_back("she");
+		PatternMatcher large(patterns);
+		test.expect(large.usesAutomaton())->toBeTrue();
+
+		std::string digits;
+		for (int i = 0; i != 500; i++) {
+			digits += std::to_string(i * 13) + (i % 3 ? " she " : "-");
+		}
+		auto found = large.findAll(StringView(digits.c_str()));
+
+		u64 expected = 0;
+		bool sameOrder = true;
+		for (u64 pos = 0; pos != digits.size(); pos++) {
+			for (u64 p = 0; p != patterns.size(); p++) {
+				if (!patterns[p].isEmpty() && !digits.compare(pos, patterns[p].bufferSize() - 1, patterns[p].cString())) {
+					sameOrder = sameOrder && expected < found.size() && found[expected].pattern == p && found[expected].byteOffset == pos;
+					expected++;
+				}
+			}
+		}
+		test.expect(found.size())->toBe(expected);
+		test.expect(sameOrder)->toBeTrue();
+		test.expect(large.containsAny("no digits at all"))->toBeFalse();
+	});
+
+
+	test.test("Switch over string literals", [&] {
+		static constexpr LiteralSwitch commands("get", "set", "delete", "increment", "decrement", "append", "prepend",
+			"touch", "flush_all", "version", "verbosity", "quit", "stats", "gets", "cas", "", "a command longer than 32 bytes");
+		static_assert(commands.indexOf("delete") == 2, "Lookup at compile time");
+		static_assert(commands.indexOf("unknown") == commands.caseCount(), "Lookup at compile time");
+
+		auto dispatch = [&](const String& s) {
+			switch (commands(s)) {
+			case commands.indexOf("get"): return 1;
+			case commands.indexOf("gets"): return 2;
+			case commands.indexOf("a command longer than 32 bytes"): return 3;
+			case commands.indexOf(""): return 4;
+			default: return 0;
+			}
+		};
+
+		test.expect(dispatch("get"))->toBe(1);
+		test.expect(dispatch(String("gets", {})))->toBe(2);
+		test.expect(dispatch("a command longer than 32 bytes"))->toBe(3);
+		test.expect(dispatch(""))->toBe(4);
+		test.expect(dispatch("ge"))->toBe(0);
+		test.expect(dispatch("gett"))->toBe(0);
+		test.expect(commands("stats"))->toBe(12);
+		test.expect(commands(StringView("casual", 3)))->toBe(14);
+	});
+
+
+	test.test("Format and parse numbers", [&] {
+		auto s = String::fromInt(-1234567890123);
+		test.expect(StringIntrospection(s).isSmall())->toBeTrue();
+		test.expect(strcmp(s.cString(), "-1234567890123"))->toBeZero();
+		test.expect(*s.toInt())->toBe(-1234567890123);
+		test.expect(strcmp(String::fromDouble(0.1).cString(), "0.1"))->toBeZero();
+		test.expect(*String("2.5e3").toDouble())->toBe(2500.0);
+		test.expect(String("12a").toInt().has_value())->toBeFalse();
+		test.expect(String("").toDouble().has_value())->toBeFalse();
+
+		// Grows out of the small string with a known code point count
+		String t("\xc3\xa4 values: ");
+		for (int i = 0; i != 10; i++) {
+			t.append(i * 1000u).append(",");
+		}
+		t.append(0.5f).append(",").append((u8)200);
+		test.expect(strcmp(t.cString(), "\xc3\xa4 values: 0,1000,2000,3000,4000,5000,6000,7000,8000,9000,0.5,200"))->toBeZero();
+		test.expect(isNumberType<char32_t> || isNumberType<wchar_t>)->toBeFalse();
+		test.expect(StringIntrospection(t).hasCachedCodePoints())->toBeTrue();
+		test.expect(t.length())->toBe(t.bufferSize() - 2);
+	});
+
+
+	test.test("Format strings into a single buffer", [&] {
+		auto small = String::format("{} + {} = {}", 1, 2.5, 3.5f);
+		test.expect(StringIntrospection(small).isSmall())->toBeTrue();
+		test.expect(strcmp(small.cString(), "1 + 2.5 = 3.5"))->toBeZero();
+
+		static_assert(FormatString::countArguments("{{{}}} \xc3\xa4 {} and {}: {}") == 4, "Parsed at compile time");
+		String name("a name that does not fit into a small string", {});
+		auto s = String::format(COW_FORMAT("{{{}}} \xc3\xa4 {} and {}: {}"), Character((const u8*)"\xc3\xb6"), name, "literal", -42);
+		test.expect(strcmp(s.cString(), "{\xc3\xb6} \xc3\xa4 a name that does not fit into a small string and literal: -42"))->toBeZero();
+		test.expect(StringIntrospection(s).hasCachedCodePoints())->toBeTrue();
+		test.expect(s.bufferCapacity())->toBeInside(s.bufferSize(), 2 * s.bufferSize());
+		test.expect(s.length())->toBe(s.bufferSize() - 3);
+
+		// Strings built at runtime may have any number of pieces
+		std::string json;
+		for (int i = 0; i != 20; i++) {
+			json += "{{\"k\": {}}}";
+		}
+		auto t = String::format(json.c_str(), 1, 2, 3);
+		test.expect(strncmp(t.cString(), "{\"k\": 1}{\"k\": 2}{\"k\": 3}{\"k\": }", 31))->toBeZero();
+		test.expect(t.bufferSize())->toBe(strlen(t.cString()) + 1);
+		test.expect(t.length())->toBe(t.bufferSize() - 1);
+
+		// Missing arguments leave their placeholders empty
+		auto u = String::format(FormatString("a {} b {} c {} tail of text"), 1);
+		test.expect(strcmp(u.cString(), "a 1 b  c  tail of text"))->toBeZero();
+		test.expect(u.bufferSize())->toBe(23);
+	});
+
+
+	test.test("Stream into and out of strings", [&] {
+		StringOutputStream out;
+		out << "x = " << 42;
+		auto small = out.take();
+		test.expect(StringIntrospection(small).isSmall())->toBeTrue();
+		test.expect(strcmp(small.cString(), "x = 42"))->toBeZero();
+
+		// The stream is reused and grows the string while writing
+		for (int i = 0; i != 100; i++) {
+			out << i << ' ';
+		}
+		out << "\xc3\xa4";
+		auto large = out.take();
+		test.expect(large.bufferSize())->toBe(293);
+		test.expect(large.length())->toBe(291);
+		test.expect(strncmp(large.cString(), "0 1 2 3", 7))->toBeZero();
+		test.expect(out.str().isEmpty())->toBeTrue();
+
+		// Copies of the synced string keep their text while the stream goes on writing
+		out << "a first message that is too long for a small string";
+		String first = out.str();
+		out << " SECOND";
+		test.expect(strcmp(first.cString(), "a first message that is too long for a small string"))->toBeZero();
+		test.expect(strcmp(out.str().cString(), "a first message that is too long for a small string SECOND"))->toBeZero();
+		out.take();
+
+		String appended("prefix ");
+		{
+			StringOutputBuffer buffer(appended);
+			std::ostream stream(&buffer);
+			stream << 1.5 << std::flush;
+			test.expect(strcmp(appended.cString(), "prefix 1.5"))->toBeZero();
+		}
+
+		StringInputStream in(large);
+		int a, b;
+		in >> a >> b;
+		test.expect(a)->toBe(0);
+		test.expect(b)->toBe(1);
+		in.seekg(-3, std::ios_base::end);
+		std::string rest;
+		in >> rest;
+		test.expect(rest == "\xc3\xa4")->toBeTrue();
+
+		in.reset(String("7"));
+		in >> a;
+		test.expect(a)->toBe(7);
+	});
+
+
+	test.test("Transcode to UTF-16 and UTF-32", [&] {
+		String s("plain ascii text, then \xc3\xa4\xe2\x82\xac and an emoji \xf0\x9f\xa5\x9d at the end", {});
+		auto utf16 = Transcode::toUtf16(s);
+		test.expect(utf16.has_value())->toBeTrue();
+		test.expect(utf16->size())->toBe(s.length() + 1);
+		test.expect(utf16->at(23) == u'\u00e4')->toBeTrue();
+		test.expect(utf16->at(39) == 0xD83E)->toBeTrue();
+
+		auto utf32 = Transcode::toUtf32(s);
+		test.expect(utf32->size())->toBe(s.length());
+		test.expect(utf32->at(39) == U'\U0001F95D')->toBeTrue();
+
+		auto back = Transcode::fromUtf16(*utf16);
+		test.expect(strcmp(back->cString(), s.cString()))->toBeZero();
+		test.expect(StringIntrospection(*back).hasCachedCodePoints())->toBeTrue();
+		test.expect(back->length())->toBe(s.length());
+		test.expect(strcmp(Transcode::fromUtf32(*utf32)->cString(), s.cString()))->toBeZero();
+
+		// Invalid input is rejected
+		test.expect(Transcode::toUtf16(String("\xc0\xafoverlong")).has_value())->toBeFalse();
+		test.expect(Transcode::toUtf32(String("\xed\xa0\x80surrogate")).has_value())->toBeFalse();
+		test.expect(Transcode::toUtf16(String("truncated\xe2\x82")).has_value())->toBeFalse();
+		test.expect(Transcode::fromUtf16(std::u16string(1, (char16_t)0xDC00)).has_value())->toBeFalse();
+		test.expect(Transcode::fromUtf32(std::u32string(1, (char32_t)0x110000)).has_value())->toBeFalse();
+	});
+
+
+	test.test("Encode and decode code points", [&] {
+		u32 codePoints[] = { 0x24, 0xE4, 0x20AC, 0x1F95D, 0x10FFFF };
+		String s;
+		for (auto cp : codePoints) {
+			auto c = Character::fromCodePoint(cp);
+			test.expect(c.toUnicodeCodepoint())->toBe(cp);
+			s.append(c);
+		}
+		test.expect(strcmp(s.cString(), "$\xc3\xa4\xe2\x82\xac\xf0\x9f\xa5\x9d\xf4\x8f\xbf\xbf"))->toBeZero();
+		test.expect(Character::fromCodePoint(0xD800).toUnicodeCodepoint())->toBe(0xFFFD);
+
+		// Only the bytes of the character are read
+		std::unique_ptr<u8[]> emoji(new u8[4]{ 0xf0, 0x9f, 0xa5, 0x9d });
+		test.expect(Character(emoji.get()).toUnicodeCodepoint())->toBe(0x1F95D);
+
+		// Appending keeps the cached code point count of a dynamic string
+		String t("a string which is too long to be small", {});
+		t.reserve(100);
+		test.expect(t.length())->toBe(38);
+		for (int i = 0; i != 20; i++) {
+			t.append(Character::fromCodePoint(0x1F95D));
+		}
+		test.expect(StringIntrospection(t).hasCachedCodePoints())->toBeTrue();
+		test.expect(t.length())->toBe(58);
+		test.expect(t.bufferSize())->toBe(39 + 80);
+	});
+
+
+	test.test("Change case and compare ignoring case", [&] {
+		String literal = "Content-Type: TEXT/HTML; \xc3\x84\xc3\x96\xc3\x9c \xce\xa3\xce\xa9 \xd0\x96 \xc5\xb8";
+		String lower = literal;
+		lower.toLower();
+		test.expect(StringIntrospection(literal).isLiteral())->toBeTrue();
+		test.expect(StringIntrospection(lower).mode())->toBe(StringIntrospection::Mode::Owned);
+		test.expect(strcmp(lower.cString(), "content-type: text/html; \xc3\xa4\xc3\xb6\xc3\xbc \xcf\x83\xcf\x89 \xd0\xb6 \xc3\xbf"))->toBeZero();
+
+		String upper = lower;
+		upper.toUpper();
+		test.expect(strcmp(upper.cString(), "CONTENT-TYPE: TEXT/HTML; \xc3\x84\xc3\x96\xc3\x9c \xce\xa3\xce\xa9 \xd0\x96 \xc5\xb8"))->toBeZero();
+
+		test.expect(literal.equalsIgnoreCase(lower))->toBeTrue();
+		test.expect(upper.equalsIgnoreCase(lower))->toBeTrue();
+		test.expect(literal.hashIgnoreCase())->toBe(lower.hashIgnoreCase());
+		test.expect(upper.hashIgnoreCase())->toBe(lower.hashIgnoreCase());
+		test.expect(literal.equalsIgnoreCase(String("Content-Type: text/plain")))->toBeFalse();
+
+		// Nothing is copied if no letter changes
+		String shared("already lower case text which is not small", {});
+		String copy = shared;
+		copy.toLower();
+		test.expect(StringIntrospection(copy).isShared())->toBeTrue();
+
+		String small("MiXeD");
+		small.toUpper();
+		test.expect(strcmp(small.cString(), "MIXED"))->toBeZero();
+	});
+
+
+	test.test("Normalize to NFC and NFD", [&] {
+		String composed = "Caf\xc3\xa9 na\xc3\xafve r\xc3\xa9sum\xc3\xa9 in plain text";
+		String copy = composed;
+		test.expect(copy.isNFC())->toBeTrue();
+		test.expect(copy.isNFD())->toBeFalse();
+		copy.toNFC();
+		test.expect(StringIntrospection(copy).isLiteral())->toBeTrue();
+		test.expect(copy.cString() == composed.cString())->toBeTrue();
+
+		// Decomposing adds one code point and one byte per letter
+		String decomposed = composed;
+		decomposed.toNFD();
+		test.expect(strcmp(decomposed.cString(), "Cafe\xcc\x81 nai\xcc\x88ve re\xcc\x81sume\xcc\x81 in plain text"))->toBeZero();
+		test.expect(decomposed.length())->toBe(composed.length() + 4);
+		test.expect(decomposed.isNFD())->toBeTrue();
+
+		decomposed.toNFC();
+		test.expect(decomposed == composed)->toBeTrue();
+		test.expect(decomposed.length())->toBe(composed.length());
+
+		// Marks are ordered by their classes, and a mark of the same class blocks the composition
+		String ordered("\xc3\xa1\xcc\xa8");
+		test.expect(strcmp(ordered.toNFD().cString(), "a\xcc\xa8\xcc\x81"))->toBeZero();
+		test.expect(strcmp(ordered.toNFC().cString(), "\xc4\x85\xcc\x81"))->toBeZero();
+		String blocked("a\xcc\x81\xcc\x81");
+		test.expect(strcmp(blocked.toNFC().cString(), "\xc3\xa1\xcc\x81"))->toBeZero();
+
+		// A mark that might compose with the character in front of it is checked against the
+		// normalized text. Text that turns out to be normalized keeps its buffer
+		String dotBelow("e\xcc\xa3\xcc\x81 and more text to make it a large string");
+		test.expect(dotBelow.isNFC())->toBeFalse();
+		test.expect(dotBelow.isNFD())->toBeTrue();
+		test.expect(strcmp(dotBelow.toNFC().cString(), "\xe1\xba\xb9\xcc\x81 and more text to make it a large string"))->toBeZero();
+		test.expect(dotBelow.isNFC())->toBeTrue();
+		String maybe("\xe1\xba\xb9\xcc\x81 and more text to make it a large string");
+		auto maybePtr = maybe.cString();
+		test.expect(maybe.isNFC())->toBeTrue();
+		test.expect(maybe.toNFC().cString() == maybePtr)->toBeTrue();
+		test.expect(String("\xe1\xba\xb9\xcc\x81").isNFC())->toBeTrue();
+
+		// All of Unicode is known, including the arithmetic Hangul syllables
+		test.expect(String("\xd0\x9f\xd1\x80\xd0\xb8").isNFC())->toBeTrue();
+		test.expect(String("\xd0\x9f\xd1\x80\xd0\xb8").isNFD())->toBeTrue();
+		String greek("\xe1\xbe\x84");
+		test.expect(strcmp(greek.toNFD().cString(), "\xce\xb1\xcc\x93\xcc\x81\xcd\x85"))->toBeZero();
+		test.expect(strcmp(greek.toNFC().cString(), "\xe1\xbe\x84"))->toBeZero();
+		String hangul("\xed\x95\x9c");
+		test.expect(hangul.isNFD())->toBeFalse();
+		test.expect(strcmp(hangul.toNFD().cString(), "\xe1\x84\x92\xe1\x85\xa1\xe1\x86\xab"))->toBeZero();
+		test.expect(hangul.isNFC())->toBeFalse();
+		test.expect(strcmp(hangul.toNFC().cString(), "\xed\x95\x9c"))->toBeZero();
+		test.expect(String("\xe6\xbc\xa2\xe5\xad\x97 and caf\xc3\xa9").isNFC())->toBeTrue();
+
+		// Changing the text forgets that it is normalized
+		decomposed.append("e\xcc\x81");
+		test.expect(decomposed.isNFC())->toBeFalse();
+
+		// Also when a single character is written into the free capacity
+		StringOutputStream out;
+		out << "text written by a stream that does not know its code point count, like this one";
+		auto streamed = out.take();
+		streamed.reserve(streamed.bufferSize() + 4);
+		test.expect(StringIntrospection(streamed).hasCachedCodePoints())->toBeFalse();
+		test.expect(streamed.isNFC())->toBeTrue();
+		auto oldPtr = streamed.cString();
+		streamed.append(Character::fromCodePoint(0x301));
+		test.expect(streamed.cString() == oldPtr)->toBeTrue();
+		test.expect(streamed.isNFC())->toBeFalse();
+	});
+
+
+	test.test("Trim whitespace and escape for JSON and HTML", [&] {
+		String small(" \t small text \r\n");
+		small.trim();
+		test.expect(strcmp(small.cString(), "small text"))->toBeZero();
+		test.expect(StringIntrospection(small).isSmall())->toBeTrue();
+
+		// Removing the start of shared text only moves it
+		String shared("                    text with spaces around it which is not small    ");
+		String start = shared;
+		start.trimStart();
+		test.expect(StringIntrospection(start).isShared())->toBeTrue();
+		test.expect(start.cString() == shared.cString() + 20)->toBeTrue();
+		test.expect(start.length())->toBe(shared.length() - 20);
+
+		// The end of shared text cannot get a null byte without copying
+		String both = shared;
+		both.trim();
+		test.expect(strcmp(both.cString(), "text with spaces around it which is not small"))->toBeZero();
+		test.expect(StringIntrospection(both).mode())->toBe(StringIntrospection::Mode::Owned);
+		test.expect(strcmp(shared.cString() + 20, "text with spaces around it which is not small    "))->toBeZero();
+
+		String blank("   \n   ");
+		test.expect(blank.trimEnd().isEmpty())->toBeTrue();
+
+		String json("{");
+		json.appendJsonEscaped(String("Say \"hi\"\n\tto C:\\path and \x01 the \xc3\xa4 umlaut"));
+		json.append("}");
+		test.expect(strcmp(json.cString(), "{Say \\\"hi\\\"\\n\\tto C:\\\\path and \\u0001 the \xc3\xa4 umlaut}"))->toBeZero();
+		test.expect(json.length())->toBe(json.bufferSize() - 2);
+
+		String html;
+		html.appendHtmlEscaped("<a href=\"x\">Tom & Jerry's</a>");
+		test.expect(strcmp(html.cString(), "&lt;a href=&quot;x&quot;&gt;Tom &amp; Jerry&#39;s&lt;/a&gt;"))->toBeZero();
+		test.expect(html.length())->toBe(html.bufferSize() - 1);
+	});
+
+
+	test.test("Encode and decode hex and base64", [&] {
+		u8 bytes[40];
+		for (u64 i = 0; i != sizeof(bytes); i++) {
+			bytes[i] = (u8)(i * 37 + 250);
+		}
+
+		auto hex = BinaryText::toHex(bytes, sizeof(bytes));
+		test.expect(hex.bufferSize())->toBe(81);
+		test.expect(strncmp(hex.cString(), "fa1f44698e", 10))->toBeZero();
+		// The code point count is known without counting
+		test.expect(StringIntrospection(hex).hasCachedCodePoints())->toBeTrue();
+		test.expect(hex.length())->toBe(80);
+		test.expect(strcmp(BinaryText::toHex(bytes, 3, true).cString(), "FA1F44"))->toBeZero();
+
+		auto decoded = BinaryText::fromHex(hex);
+		test.expect(decoded.has_value())->toBeTrue();
+		test.expect(memcmp(decoded->data(), bytes, sizeof(bytes)))->toBeZero();
+		test.expect(BinaryText::fromHex(String("0123456789abcdefABCDEF0123456789xy")).has_value())->toBeFalse();
+		test.expect(BinaryText::fromHex(String("abc")).has_value())->toBeFalse();
+
+		const char* text = "Many hands make light work.";
+		auto base64 = BinaryText::toBase64((const u8*)text, strlen(text));
+		test.expect(strcmp(base64.cString(), "TWFueSBoYW5kcyBtYWtlIGxpZ2h0IHdvcmsu"))->toBeZero();
+		test.expect(StringIntrospection(base64).hasCachedCodePoints())->toBeTrue();
+		test.expect(strcmp(BinaryText::toBase64((const u8*)"light w", 7).cString(), "bGlnaHQgdw=="))->toBeZero();
+		test.expect(strcmp(BinaryText::toBase64((const u8*)"light wo", 8).cString(), "bGlnaHQgd28="))->toBeZero();
+
+		auto back = BinaryText::fromBase64(base64);
+		test.expect(back.has_value())->toBeTrue();
+		test.expect(back->size())->toBe(strlen(text));
+		test.expect(memcmp(back->data(), text, back->size()))->toBeZero();
+
+		auto binary = BinaryText::fromBase64(BinaryText::toBase64(bytes, sizeof(bytes)));
+		test.expect(binary->size())->toBe(sizeof(bytes));
+		test.expect(memcmp(binary->data(), bytes, sizeof(bytes)))->toBeZero();
+		test.expect(BinaryText::fromBase64(String("bGlnaHQgd28")).has_value())->toBeFalse();
+		test.expect(BinaryText::fromBase64(String("bGln=HQgd28=")).has_value())->toBeFalse();
+	});
+
+
+	test.test("Parallel length, validation, search and hashing", [&] {
+		// Large enough to be split into chunks
+		String text;
+		for (u64 i = 0; i != 200000; i++) {
+			text.append("abc \xc3\xa4\xe2\x82\xac ");
+		}
+		text.append("needle");
+		auto numBytes = text.bufferSize() - 1;
+
+		// Owned text from a C string does not know its length yet
+		String copy(text.cString());
+		test.expect(StringIntrospection(copy).hasCachedCodePoints())->toBeFalse();
+		test.expect(Parallel::length(copy))->toBe(200000 * 7 + 6);
+		test.expect(StringIntrospection(copy).hasCachedCodePoints())->toBeTrue();
+		test.expect(Character::countCodePointsInBuffer((const u8*)text.cString(), numBytes))->toBe(200000 * 7 + 6);
+
+		test.expect(Parallel::isValidUtf8(text))->toBeTrue();
+		test.expect(*Parallel::find(text, "needle"))->toBe(numBytes - 6);
+		test.expect(*Parallel::find(text, "\xe2\x82\xac abc"))->toBe(6);
+		test.expect(Parallel::find(text, "haystack").has_value())->toBeFalse();
+
+		String invalid = text;
+		invalid.append("\xe2\x82");
+		test.expect(Parallel::isValidUtf8(invalid))->toBeFalse();
+
+		// Broken text is counted the same as by length()
+		String broken("\xa4\xa4 ");
+		broken.append(text);
+		String brokenCopy(broken.cString());
+		auto brokenLength = Character::countCodePointsInBuffer((const u8*)broken.cString(), broken.bufferSize() - 1);
+		test.expect(Parallel::length(brokenCopy))->toBe(brokenLength);
+		test.expect(Parallel::lengthAll(&brokenCopy, &brokenCopy + 1)[0])->toBe(brokenLength);
+
+		std::vector<String> strings;
+		for (u64 i = 0; i != 5000; i++) {
+			strings.push_back(String::format("string number {} \xc3\xa4", i));
+		}
+		auto hashes = Parallel::hashAll(strings);
+		auto lengths = Parallel::lengthAll(strings);
+		test.expect(hashes.size())->toBe(strings.size());
+		test.expect(hashes[4321])->toBe(strings[4321].hash());
+		test.expect(lengths[4321])->toBe(strings[4321].length());
+		test.expect(lengths[7])->toBe(17);
+	});
+
+
+	test.test("Line index of large text", [&] {
+		String text;
+		for (u64 i = 0; i != 1000; i++) {
+			text.append(String::format("line {} with \xc3\xa4\n", i));
+		}
+		text.append("last line without a break");
+
+		// Owned text from a C string does not know its length yet
+		String copy(text.cString());
+		test.expect(copy.lineCount())->toBe(1001);
+		test.expect(StringIntrospection(copy).hasCachedCodePoints())->toBeTrue();
+		test.expect(copy.length())->toBe(text.length());
+
+		test.expect(copy.lineAt(0) == StringView("line 0 with \xc3\xa4"))->toBeTrue();
+		test.expect(copy.lineAt(999) == StringView("line 999 with \xc3\xa4"))->toBeTrue();
+		test.expect(copy.lineAt(1000) == StringView("last line without a break"))->toBeTrue();
+		auto offset = (u64)(copy.lineAt(500).data() - (const u8*)copy.cString());
+		test.expect(copy.lineOfByte(offset))->toBe(500);
+		test.expect(copy.lineOfByte(offset - 1))->toBe(499);
+
+		// Copies share the index, and writing to the text drops it
+		String shared = copy;
+		test.expect(shared.lineAt(500).data() == copy.lineAt(500).data())->toBeTrue();
+		copy.setCharAt(0, Character((const u8*)"\n"));
+		test.expect(copy.lineCount())->toBe(1002);
+		test.expect(shared.lineCount())->toBe(1001);
+
+		// Slices of the same buffer share one index, which grows to cover both of them
+		String back = shared;
+		back.removePrefix(Character::countCodePointsInBuffer((const u8*)shared.cString(), shared.lineAt(600).data() - (const u8*)shared.cString()));
+		auto index = StringIntrospection(shared).bufferAttachment();
+		test.expect(back.lineCount())->toBe(401);
+		test.expect(back.lineAt(0) == StringView("line 600 with \xc3\xa4"))->toBeTrue();
+		test.expect(back.lineOfByte(0))->toBe(0);
+		test.expect(shared.lineCount())->toBe(1001);
+		test.expect(StringIntrospection(back).bufferAttachment() == index)->toBeTrue();
+
+		// The index also grows in front of the range it was built for
+		String first(shared.cString());
+		String second = first;
+		second.removePrefix(Character::countCodePointsInBuffer((const u8*)shared.cString(), shared.lineAt(100).data() - (const u8*)shared.cString()));
+		test.expect(second.lineCount())->toBe(901);
+		test.expect(second.lineAt(1) == StringView("line 101 with \xc3\xa4"))->toBeTrue();
+		auto secondIndex = StringIntrospection(second).bufferAttachment();
+		test.expect(first.lineCount())->toBe(1001);
+		test.expect(first.lineAt(100) == StringView("line 100 with \xc3\xa4"))->toBeTrue();
+		test.expect(first.lineOfByte(second.lineAt(1).data() - (const u8*)first.cString()))->toBe(101);
+		test.expect(StringIntrospection(first).bufferAttachment() == secondIndex)->toBeTrue();
+
+		// Broken sequences are counted the same as by length()
+		std::string brokenText = "\xa4\xe2 lone continuation and lead bytes\n\xf0\x9f second line " + std::string(40, '\xa4');
+		String broken(brokenText.c_str());
+		test.expect(broken.lineCount())->toBe(2);
+		test.expect(broken.length())->toBe(Character::countCodePointsInBuffer((const u8*)brokenText.c_str(), brokenText.size()));
+
+		String small("a\nb\n");
+		test.expect(small.lineCount())->toBe(3);
+		test.expect(small.lineAt(1) == StringView("b"))->toBeTrue();
+		test.expect(small.lineAt(2).isEmpty())->toBeTrue();
+	});
+
+
+	test.test("Chunked string only detaches the written chunk", [&] {
+		std::vector<char> block(4 * ChunkedString::TChunkCapacity, 'a');
+		block.back() = '\0';
+		String s(block.data());
+		s.append("\xc3\xa4!");
+
+		ChunkedString c = s;
+		test.expect(c.chunkCount())->toBe(5);
+		test.expect(c.length())->toBe(s.length());
+		test.expect(c.cString() == s.cString())->toBeTrue();
+
+		ChunkedString c2 = c;
+		const u8 emoji[8] = { 0xf0, 0x9f, 0xa5, 0x9d };
+		c2.setCharAt(2 * ChunkedString::TChunkCapacity, Character(emoji));
+		// The full chunk is split to make room for the larger code point
+		test.expect(c2.chunkCount())->toBe(6);
+		test.expect(c2.isChunkShared(0))->toBeTrue();
+		test.expect(c2.isChunkShared(1))->toBeTrue();
+		test.expect(c2.isChunkShared(2))->toBeFalse();
+		test.expect(c2.isChunkShared(3))->toBeFalse();
+		test.expect(c2.isChunkShared(4))->toBeTrue();
+		test.expect(c2.bufferSize())->toBe(c.bufferSize() + 3);
+		test.expect(c2.length())->toBe(c.length());
+
+		// The contiguous string is materialized on demand
+		test.expect(strlen(c2.cString()))->toBe(c2.bufferSize() - 1);
+		test.expect(c2.toString().length())->toBe(c2.length());
+		test.expect(memcmp(c2.charAt(2 * ChunkedString::TChunkCapacity).bytes(), emoji, 4))->toBeZero();
+		test.expect(c.charAt(2 * ChunkedString::TChunkCapacity).byteCount())->toBe(1);
+		test.expect(c2.charAt(c2.length() - 2).byteCount())->toBe(2);
+	});
+
+	test.test("Chunked string splits a long run of continuation bytes", [&] {
+		std::vector<char> block(2 * ChunkedString::TChunkCapacity + 10, '\x80');
+		block.back() = '\0';
+		String s(block.data());
+
+		ChunkedString c = s;
+		test.expect(c.chunkCount())->toBe(3);
+		test.expect(c.bufferSize())->toBe(s.bufferSize());
+		test.expect(memcmp(c.toString().cString(), block.data(), block.size()))->toBeZero();
+	});
+
 	std::cout << test;
 }
 
@@ -0,0 +1,161 @@
+
+#include "binarytext.h"
+#include "simd.h"
+
+static constexpr char base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Splits 3 bytes into 4 values of 6 bits
+static void splitBase64(const u8* ptr, u8* values) {
+	values[0] = ptr[0] >> 2;
+	values[1] = (u8)(((ptr[0] & 0x03) << 4) | (ptr[1] >> 4));
+	values[2] = (u8)(((ptr[1] & 0x0F) << 2) | (ptr[2] >> 6));
+	values[3] = ptr[2] & 0x3F;
+}
+
+static void joinBase64(const u8* values, u8* out) {
+	out[0] = (u8)((values[0] << 2) | (values[1] >> 4));
+	out[1] = (u8)((values[1] << 4) | (values[2] >> 2));
+	out[2] = (u8)((values[2] << 6) | values[3]);
+}
+
+static i32 hexValue(u8 c) {
+	u8 lower = c | 0x20;
+	if (c >= '0' && c <= '9') {
+		return c - '0';
+	}
+	return lower >= 'a' && lower <= 'f' ? lower - 'a' + 10 : -1;
+}
+
+static i32 base64Value(u8 c) {
+	auto pos = c ? strchr(base64Alphabet, c) : nullptr;
+	return pos ? (i32)(pos - base64Alphabet) : -1;
+}
+
+String BinaryText::toHex(const u8* ptr, u64 length, bool upperCase) {
+	String s;
+	auto out = s.initAsUninitialized(2 * length + 1, 2 * length);
+
+	u64 i = 0;
+	for (; length - i >= Simd::TGroupSize / 2; i += Simd::TGroupSize / 2) {
+		Simd::bytesToHex(ptr + i, out + 2 * i, upperCase);
+	}
+
+	auto digits = upperCase ? "0123456789ABCDEF" : "0123456789abcdef";
+	for (; i < length; i++) {
+		out[2 * i] = digits[ptr[i] >> 4];
+		out[2 * i + 1] = digits[ptr[i] & 0x0F];
+	}
+
+	return s;
+}
+
+String BinaryText::toBase64(const u8* ptr, u64 length) {
+	auto numChars = (length + 2) / 3 * 4;
+	String s;
+	auto out = s.initAsUninitialized(numChars + 1, numChars);
+
+	// 12 bytes become 16 characters
+	u8 values[Simd::TGroupSize];
+	u64 i = 0;
+	for (; length - i >= 12; i += 12, out += Simd::TGroupSize) {
+		for (u64 j = 0; j != 4; j++) {
+			splitBase64(ptr + i + 3 * j, values + 4 * j);
+		}
+		Simd::base64Encode(values, out);
+	}
+
+	for (; i < length; i += 3, out += 4) {
+		// The missing bytes of the last group are zero and become padding
+		u8 bytes[3] = {};
+		auto numBytes = std::min<u64>(length - i, 3);
+		memcpy(bytes, ptr + i, numBytes);
+		splitBase64(bytes, values);
+		for (u64 j = 0; j != 4; j++) {
+			out[j] = j <= numBytes ? base64Alphabet[values[j]] : '=';
+		}
+	}
+
+	return s;
+}
+
+std::optional<u64> BinaryText::fromHex(const u8* ptr, u64 length, u8* out) {
+	if (length % 2) {
+		return {};
+	}
+
+	u64 i = 0;
+	while (length - i >= Simd::TGroupSize && Simd::hexToBytes(ptr + i, out + i / 2)) {
+		i += Simd::TGroupSize;
+	}
+
+	// The rest, or a group with an invalid character
+	for (; i < length; i += 2) {
+		auto high = hexValue(ptr[i]);
+		auto low = hexValue(ptr[i + 1]);
+		if (high < 0 || low < 0) {
+			return {};
+		}
+		out[i / 2] = (u8)((high << 4) | low);
+	}
+
+	return length / 2;
+}
+
+std::optional<u64> BinaryText::fromBase64(const u8* ptr, u64 length, u8* out) {
+	if (length % 4) {
+		return {};
+	}
+
+	// Groups with padding are left to the scalar loop
+	u8 values[Simd::TGroupSize];
+	u64 i = 0;
+	u64 written = 0;
+	while (length - i >= Simd::TGroupSize && Simd::base64Decode(ptr + i, values)) {
+		for (u64 j = 0; j != 4; j++) {
+			joinBase64(values + 4 * j, out + written + 3 * j);
+		}
+		i += Simd::TGroupSize;
+		written += 12;
+	}
+
+	for (; i < length; i += 4) {
+		// Only the last group may end with one or two '='
+		auto isLast = i + 4 == length;
+		u64 numPadding = isLast ? (ptr[i + 3] == '=') + (ptr[i + 2] == '=' && ptr[i + 3] == '=') : 0;
+		for (u64 j = 0; j != 4; j++) {
+			auto value = j < 4 - numPadding ? base64Value(ptr[i + j]) : 0;
+			if (value < 0) {
+				return {};
+			}
+			values[j] = (u8)value;
+		}
+
+		u8 bytes[3];
+		joinBase64(values, bytes);
+		memcpy(out + written, bytes, 3 - numPadding);
+		written += 3 - numPadding;
+	}
+
+	return written;
+}
+
+std::optional<std::vector<u8>> BinaryText::fromHex(const String& s) {
+	auto length = s.isEmpty() ? 0 : s.bufferSize() - 1;
+	std::vector<u8> bytes(length / 2);
+	auto numBytes = fromHex((const u8*)s.cString(), length, bytes.data());
+	if (!numBytes) {
+		return {};
+	}
+	return bytes;
+}
+
+std::optional<std::vector<u8>> BinaryText::fromBase64(const String& s) {
+	auto length = s.isEmpty() ? 0 : s.bufferSize() - 1;
+	std::vector<u8> bytes(length / 4 * 3);
+	auto numBytes = fromBase64((const u8*)s.cString(), length, bytes.data());
+	if (!numBytes) {
+		return {};
+	}
+	bytes.resize(*numBytes);
+	return bytes;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <vector>
+
+#include "string.h"
+
+// Encodes binary data as hex or base64 text and decodes it again, 16 characters at a time.
+// The encoded text is ASCII, so it is written straight into a presized string together with
+// its code point count, which never has to be counted
+class BinaryText {
+public:
+	static String toHex(const u8* ptr, u64 length, bool upperCase = false);
+	static String toBase64(const u8* ptr, u64 length);
+
+	// Write into caller provided buffers and return the number of written bytes, or nothing
+	// if the text is not valid. The buffer needs room for length / 2 bytes (hex) or for
+	// length / 4 * 3 bytes (base64). Base64 text has to be padded with '='
+	static std::optional<u64> fromHex(const u8* ptr, u64 length, u8* out);
+	static std::optional<u64> fromBase64(const u8* ptr, u64 length, u8* out);
+
+	static std::optional<std::vector<u8>> fromHex(const String& s);
+	static std::optional<std::vector<u8>> fromBase64(const String& s);
+};
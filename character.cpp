@@ -1,5 +1,158 @@
 
+#include <algorithm>
+#include <iterator>
+
 #include "character.h"
+#include "unicodedata.h"
+
+namespace {
+	// Code points first, first + stride, ... last are mapped by adding the delta
+	struct CaseRange {
+		u32 first;
+		u32 last;
+		i32 delta;
+		u32 stride;
+	};
+
+	constexpr CaseRange lowerCaseRanges[] = {
+		{ 0xC0, 0xD6, 32, 1 }, { 0xD8, 0xDE, 32, 1 },
+		{ 0x100, 0x12E, 1, 2 }, { 0x132, 0x136, 1, 2 }, { 0x139, 0x147, 1, 2 }, { 0x14A, 0x176, 1, 2 },
+		{ 0x178, 0x178, -121, 1 }, { 0x179, 0x17D, 1, 2 },
+		{ 0x391, 0x3A1, 32, 1 }, { 0x3A3, 0x3AB, 32, 1 },
+		{ 0x400, 0x40F, 80, 1 }, { 0x410, 0x42F, 32, 1 }
+	};
+
+	constexpr CaseRange upperCaseRanges[] = {
+		{ 0xE0, 0xF6, -32, 1 }, { 0xF8, 0xFE, -32, 1 }, { 0xFF, 0xFF, 121, 1 },
+		{ 0x101, 0x12F, -1, 2 }, { 0x133, 0x137, -1, 2 }, { 0x13A, 0x148, -1, 2 }, { 0x14B, 0x177, -1, 2 },
+		{ 0x17A, 0x17E, -1, 2 },
+		{ 0x3B1, 0x3C1, -32, 1 }, { 0x3C2, 0x3C2, -31, 1 }, { 0x3C3, 0x3CB, -32, 1 },
+		{ 0x430, 0x44F, -32, 1 }, { 0x450, 0x45F, -80, 1 }
+	};
+
+	template<u64 N>
+	u32 mapCodePoint(const CaseRange(&ranges)[N], u32 codePoint) {
+		for (auto& r : ranges) {
+			if (codePoint < r.first) {
+				break;
+			}
+			if (codePoint <= r.last && !((codePoint - r.first) % r.stride)) {
+				return (u32)((i32)codePoint + r.delta);
+			}
+		}
+		return codePoint;
+	}
+
+	// Hangul syllables are made of a leading consonant, a vowel and an optional trailing
+	// consonant, and are decomposed and composed arithmetically
+	constexpr u32 hangulBase = 0xAC00;
+	constexpr u32 leadingBase = 0x1100;
+	constexpr u32 vowelBase = 0x1161;
+	constexpr u32 trailingBase = 0x11A7;
+	constexpr u32 leadingCount = 19;
+	constexpr u32 vowelCount = 21;
+	constexpr u32 trailingCount = 28;
+	constexpr u32 hangulCount = leadingCount * vowelCount * trailingCount;
+
+	const UnicodeData::PropertyRange* findPropertyRange(u32 codePoint) {
+		// Nothing below the Latin-1 letters is special
+		if (codePoint < 0xC0) {
+			return nullptr;
+		}
+
+		auto it = std::upper_bound(std::begin(UnicodeData::propertyRanges), std::end(UnicodeData::propertyRanges), codePoint, [](u32 c, const UnicodeData::PropertyRange& r) {
+			return c < r.first;
+		});
+		if (it == std::begin(UnicodeData::propertyRanges) || (it - 1)->last < codePoint) {
+			return nullptr;
+		}
+		return it - 1;
+	}
+}
+
+u32 Character::toLowerCodePoint(u32 codePoint) {
+	if (codePoint < 0x80) {
+		return codePoint >= 'A' && codePoint <= 'Z' ? codePoint + 0x20 : codePoint;
+	}
+	return mapCodePoint(lowerCaseRanges, codePoint);
+}
+
+u32 Character::toUpperCodePoint(u32 codePoint) {
+	if (codePoint < 0x80) {
+		return codePoint >= 'a' && codePoint <= 'z' ? codePoint - 0x20 : codePoint;
+	}
+	return mapCodePoint(upperCaseRanges, codePoint);
+}
+
+u32 Character::foldCodePoint(u32 codePoint) {
+	// The final sigma folds to the normal one
+	return codePoint == 0x3C2 ? 0x3C3 : toLowerCodePoint(codePoint);
+}
+
+u64 Character::decomposeCodePoint(u32 codePoint, u32* out) {
+	if (codePoint - hangulBase < hangulCount) {
+		auto index = codePoint - hangulBase;
+		out[0] = leadingBase + index / (vowelCount * trailingCount);
+		out[1] = vowelBase + index % (vowelCount * trailingCount) / trailingCount;
+		out[2] = trailingBase + index % trailingCount;
+		return out[2] == trailingBase ? 2 : 3;
+	}
+
+	auto range = findPropertyRange(codePoint);
+	if (!range || !(range->flags & UnicodeData::TNotNFD)) {
+		return 0;
+	}
+
+	auto it = std::lower_bound(std::begin(UnicodeData::decompositions), std::end(UnicodeData::decompositions), codePoint, [](const UnicodeData::Decomposition& d, u32 c) {
+		return d.codePoint < c;
+	});
+	assert(it != std::end(UnicodeData::decompositions) && it->codePoint == codePoint);
+	memcpy(out, UnicodeData::decompositionCodePoints + it->offset, it->length * sizeof(u32));
+	return it->length;
+}
+
+u32 Character::composeCodePoints(u32 first, u32 second) {
+	// A leading consonant and a vowel form a syllable, which may take a trailing consonant
+	if (first - leadingBase < leadingCount && second - vowelBase < vowelCount) {
+		return hangulBase + ((first - leadingBase) * vowelCount + second - vowelBase) * trailingCount;
+	}
+	if (first - hangulBase < hangulCount && !((first - hangulBase) % trailingCount) && second - trailingBase - 1 < trailingCount - 1) {
+		return first + second - trailingBase;
+	}
+
+	auto it = std::lower_bound(std::begin(UnicodeData::compositions), std::end(UnicodeData::compositions), 0, [&](const UnicodeData::Composition& c, int) {
+		return c.first < first || (c.first == first && c.second < second);
+	});
+	if (it == std::end(UnicodeData::compositions) || it->first != first || it->second != second) {
+		return 0;
+	}
+	return it->composed;
+}
+
+u8 Character::combiningClass(u32 codePoint) {
+	auto range = findPropertyRange(codePoint);
+	return range ? range->combiningClass : 0;
+}
+
+Character::QuickCheck Character::quickCheckCodePoint(u32 codePoint, bool composed, u8* combiningClass) {
+	// Hangul syllables only exist in composed text
+	if (codePoint - hangulBase < hangulCount) {
+		*combiningClass = 0;
+		return composed ? QuickCheck::Yes : QuickCheck::No;
+	}
+
+	auto range = findPropertyRange(codePoint);
+	if (!range) {
+		*combiningClass = 0;
+		return QuickCheck::Yes;
+	}
+
+	*combiningClass = range->combiningClass;
+	if (range->flags & (composed ? UnicodeData::TNotNFC : UnicodeData::TNotNFD)) {
+		return QuickCheck::No;
+	}
+	return composed && (range->flags & UnicodeData::TMaybeNFC) ? QuickCheck::Maybe : QuickCheck::Yes;
+}
 
 std::ostream& operator << (std::ostream& o, Character c) {
 	o.write((const char*)c.bytes(), c.byteCount());
@@ -2,6 +2,7 @@
 
 #include <ostream>
 #include <cassert>
+#include <cstring>
 
 #include "util.h"
 
@@ -12,40 +13,43 @@ public:
 		// 110xxxxx -> C0 - DF (192 - 223)
 		// 1110xxxx -> E0 - EF (224 - 239)
 		// 11110xxx -> F0 - F7 (240 - 247)
-
-		if (byte < 128) {
-			return 1;
-		}
-
-		if (byte < 224) {
-			return 2;
-		}
-
-		if (byte < 240) {
-			return 3;
-		}
-
-		return 4;
+		// The length is looked up by the high nibble in a table of 4 bit entries
+		return (TByteLengthTable >> ((byte >> 4) * 4)) & 0xF;
 	}
 
+	// Takes the bytes of a character in memory order, like they are stored in a Character
 	static u32 utf8ToUnicodeCodePoint(u32 utf8) {
-		if (utf8 < 128) {
-			// 0xxxxxxx
-			return utf8;
+		u8 b[4];
+		memcpy(b, &utf8, sizeof(b));
+
+		// Keep the payload bits of the leading byte, and 6 bits of every following one
+		static constexpr u8 leadingMasks[5] = { 0, 0x7F, 0x1F, 0x0F, 0x07 };
+		auto len = byteLengthFromLeadingByte(b[0]);
+		u32 codePoint = b[0] & leadingMasks[len];
+		for (u64 i = 1; i < len; i++) {
+			codePoint = (codePoint << 6) | (b[i] & 0x3F);
 		}
+		return codePoint;
+	}
 
-		if (utf8 < 224) {
-			// 110xxxxx 10xxxxxx
-			return ((utf8 & 0x1F00) >> 2) | (utf8 & 0x3F);
+	// Code points that cannot be encoded (surrogates and beyond U+10FFFF) become U+FFFD
+	static Character fromCodePoint(u32 codePoint) {
+		if (codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF)) {
+			codePoint = 0xFFFD;
 		}
 
-		if (utf8 < 240) {
-			// 1110xxxx 10xxxxxx 10xxxxxx
-			return ((utf8 & 0x0F0000) >> 4) | ((utf8 & 0x3F00) >> 2) | (utf8 & 0x3F);
+		// 1 + the number of boundaries the code point lies above
+		u64 len = 1 + (codePoint >= 0x80) + (codePoint >= 0x800) + (codePoint >= 0x10000);
+		static constexpr u8 leadingBits[5] = { 0, 0x00, 0xC0, 0xE0, 0xF0 };
+
+		u8 b[4] = { (u8)(leadingBits[len] | (codePoint >> (6 * (len - 1)))) };
+		for (u64 i = 1; i < len; i++) {
+			b[i] = (u8)(0x80 | ((codePoint >> (6 * (len - 1 - i))) & 0x3F));
 		}
 
-		// 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
-		return ((utf8 & 0x07000000) >> 6) | ((utf8 & 0x3F0000) >> 4) | ((utf8 & 0x3F00) >> 2) | (utf8 & 0x3F);
+		Character c;
+		memcpy(&c.value, b, sizeof(b));
+		return c;
 	}
 
 	static u64 countCodePointsInBuffer(const u8* ptr, u64 length) {
@@ -99,25 +103,43 @@ public:
 		return utf8ToUnicodeCodePoint(value);
 	}
 
+	// Simple case mappings, which keep the length of the UTF-8 encoding. Besides ASCII only
+	// the Latin-1, Latin Extended-A, Greek and Cyrillic letters are mapped
+	static u32 toLowerCodePoint(u32 codePoint);
+	static u32 toUpperCodePoint(u32 codePoint);
+
+	// Maps code points that only differ by case to the same one
+	static u32 foldCodePoint(u32 codePoint);
+
+	// Canonical decompositions and compositions of all of Unicode (see unicodedata.h). The
+	// full decomposition is written to 'out', which needs room for TMaxDecomposition code
+	// points, and its length is returned. It is 0 if the code point does not decompose.
+	// Composing returns 0 if the two code points do not form a primary composite
+	static constexpr u64 TMaxDecomposition = 4;
+	static u64 decomposeCodePoint(u32 codePoint, u32* out);
+	static u32 composeCodePoints(u32 first, u32 second);
+
+	// Starters have the class 0, combining marks are ordered by their classes
+	static u8 combiningClass(u32 codePoint);
+
+	// Quick check of UAX #15 whether the code point may appear in the composed or decomposed
+	// form. Maybe means that it might compose with the character in front of it
+	enum class QuickCheck { Yes, No, Maybe };
+	static QuickCheck quickCheckCodePoint(u32 codePoint, bool composed, u8* combiningClass);
+
+	// Only reads the bytes of the character the pointer points to
 	Character(const u8* ptr) {
 		assert(ptr);
-		auto len = byteLengthFromLeadingByte(*ptr);
-		switch (len) {
-		case 1:
-			value = *ptr;
-			break;
-		case 2:
-			value = *((u16*)ptr);
-			break;
-		case 3:
-			value = ptr[0] | ((u64)ptr[1] << 8) | ((u64)ptr[2] << 16);
-			break;
-		default:
-			value = *((u64*)ptr);
-		}
+		memcpy(&value, ptr, byteLengthFromLeadingByte(*ptr));
 	}
 
 private:
+	Character() = default;
+
+	// Nibble i holds the byte length for leading bytes i0 - iF. Continuation bytes
+	// (80 - BF) count as 2 bytes, like the leading bytes C0 - DF
+	static constexpr u64 TByteLengthTable = 0x4322222211111111ull;
+
 	u32 value{ 0 };
 };
 
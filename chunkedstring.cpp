@@ -0,0 +1,160 @@
+
+#include <cstring>
+
+#include "chunkedstring.h"
+
+ChunkedString::Chunk ChunkedString::makeChunk(const u8* ptr, u64 numBytes) {
+	assert(numBytes <= TChunkCapacity);
+	auto buffer = Shared<u8[]>::makeUninitialized(TChunkCapacity);
+	memcpy(buffer.ptr()->value, ptr, numBytes);
+
+	return { std::move(buffer), numBytes, Character::countCodePointsInBuffer(ptr, numBytes) };
+}
+
+u64 ChunkedString::splitPosition(const u8* ptr, u64 numBytes, u64 maxBytes) {
+	if (numBytes <= maxBytes) {
+		return numBytes;
+	}
+
+	// Do not split a code point -> move back while the byte is a continuation byte (10xxxxxx)
+	// A code point has at most three of them, so a longer run is invalid text and split anywhere
+	auto pos = maxBytes;
+	while (pos && maxBytes - pos < 3 && (ptr[pos] & 0xC0) == 0x80) {
+		pos--;
+	}
+	return (ptr[pos] & 0xC0) == 0x80 ? maxBytes : pos;
+}
+
+ChunkedString::ChunkedString(const String& s) {
+	appendBytes((const u8*)s.cString(), s.bufferSize() - 1);
+
+	// The source string already is the contiguous version
+	flat.emplace(s);
+}
+
+u64 ChunkedString::findChunk(u64* idx) const {
+	// Find the chunk containing the code point and make the index relative to it
+	for (u64 i = 0; i != chunks.size(); i++) {
+		if (*idx < chunks[i].codePoints) {
+			return i;
+		}
+		*idx -= chunks[i].codePoints;
+	}
+
+	assert(false);
+	return chunks.size();
+}
+
+ChunkedString::Chunk& ChunkedString::ownChunk(u64 chunkIdx) {
+	auto& chunk = chunks[chunkIdx];
+
+	// Copy on write: Only the touched chunk is detached from other strings
+	if (chunk.buffer.refCount() > 1) {
+		auto buffer = Shared<u8[]>::makeUninitialized(TChunkCapacity);
+		memcpy(buffer.ptr()->value, chunk.data(), chunk.used);
+		chunk.buffer = std::move(buffer);
+	}
+
+	return chunk;
+}
+
+void ChunkedString::splitChunk(u64 chunkIdx) {
+	// Move the back half of a full chunk into a new one following it
+	auto& chunk = chunks[chunkIdx];
+	auto pos = splitPosition(chunk.data(), chunk.used, chunk.used / 2);
+	auto newChunk = makeChunk(chunk.data() + pos, chunk.used - pos);
+
+	chunk.used = pos;
+	chunk.codePoints -= newChunk.codePoints;
+	chunks.insert(chunks.begin() + chunkIdx + 1, std::move(newChunk));
+}
+
+void ChunkedString::appendBytes(const u8* ptr, u64 numBytes) {
+	usedBytes += numBytes;
+
+	// Fill up the last chunk first
+	if (!chunks.empty() && chunks.back().used < TChunkCapacity) {
+		auto& chunk = ownChunk(chunks.size() - 1);
+		auto len = splitPosition(ptr, numBytes, TChunkCapacity - chunk.used);
+		auto numPoints = Character::countCodePointsInBuffer(ptr, len);
+		memcpy(chunk.data() + chunk.used, ptr, len);
+		chunk.used += len;
+		chunk.codePoints += numPoints;
+		codePoints += numPoints;
+		ptr += len;
+		numBytes -= len;
+	}
+
+	while (numBytes) {
+		auto len = splitPosition(ptr, numBytes, TChunkCapacity);
+		chunks.push_back(makeChunk(ptr, len));
+		codePoints += chunks.back().codePoints;
+		ptr += len;
+		numBytes -= len;
+	}
+}
+
+ChunkedString& ChunkedString::append(const String& s) {
+	invalidateFlat();
+	appendBytes((const u8*)s.cString(), s.bufferSize() - 1);
+	return *this;
+}
+
+Character ChunkedString::charAt(u64 idx) const {
+	auto chunkIdx = findChunk(&idx);
+	auto& chunk = chunks[chunkIdx];
+	auto ptr = Character::getCodePointInBufferAt(chunk.data(), chunk.used, idx);
+	assert(ptr);
+	return { ptr };
+}
+
+void ChunkedString::setCharAt(u64 idx, Character c) {
+	auto chunkIdx = findChunk(&idx);
+
+	// Make room by splitting the chunk if the new code point does not fit
+	auto posPtr = Character::getCodePointInBufferAt(chunks[chunkIdx].data(), chunks[chunkIdx].used, idx);
+	assert(posPtr);
+	auto oldCharSize = Character::byteLengthFromLeadingByte(*posPtr);
+	auto newCharSize = c.byteCount();
+	if (chunks[chunkIdx].used - oldCharSize + newCharSize > TChunkCapacity) {
+		splitChunk(chunkIdx);
+		auto leftCodePoints = chunks[chunkIdx].codePoints;
+		if (idx >= leftCodePoints) {
+			idx -= leftCodePoints;
+			chunkIdx++;
+		}
+	}
+
+	invalidateFlat();
+
+	auto& chunk = ownChunk(chunkIdx);
+	auto ptr = (u8*)Character::getCodePointInBufferAt(chunk.data(), chunk.used, idx);
+	auto tailSize = chunk.used - (ptr - chunk.data()) - oldCharSize;
+
+	// Move the tail of the chunk to fit the new code point and copy it over the old one
+	memmove(ptr + newCharSize, ptr + oldCharSize, tailSize);
+	memcpy(ptr, c.bytes(), newCharSize);
+
+	chunk.used = chunk.used - oldCharSize + newCharSize;
+	usedBytes = usedBytes - oldCharSize + newCharSize;
+}
+
+const String& ChunkedString::toString() const {
+	if (flat) {
+		return *flat;
+	}
+
+	// Materialize the contiguous string with a single allocation
+	flat.emplace();
+	auto& s = *flat;
+	s.reserve(bufferSize());
+	for (auto& chunk : chunks) {
+		s.appendBytes(chunk.data(), chunk.used);
+	}
+
+	if (!s.isSmall()) {
+		s.dyn().setCodePoints(codePoints);
+	}
+
+	return s;
+}
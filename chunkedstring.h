@@ -0,0 +1,59 @@
+#pragma once
+
+#include <vector>
+
+#include "string.h"
+
+// Large string split into a table of ref-counted fixed size chunks. Copies share all
+// chunks, and a write only detaches the single chunk it touches instead of the whole
+// buffer. A contiguous (null-terminated) version is only materialized when requested
+class ChunkedString {
+private:
+	struct Chunk {
+		SharedPtr<Shared<u8[]>> buffer;
+		u64 used; // Number of bytes stored in the chunk (not null-terminated)
+		u64 codePoints;
+
+		u8* data() { return buffer.dataPtr(); }
+		const u8* data() const { return buffer.dataPtr(); }
+	};
+
+	static Chunk makeChunk(const u8* ptr, u64 numBytes);
+	static u64 splitPosition(const u8* ptr, u64 numBytes, u64 maxBytes);
+
+	u64 findChunk(u64* idx) const;
+	Chunk& ownChunk(u64 chunkIdx);
+	void splitChunk(u64 chunkIdx);
+	void appendBytes(const u8* ptr, u64 numBytes);
+	void invalidateFlat() { flat.reset(); }
+
+	std::vector<Chunk> chunks;
+	u64 usedBytes{ 0 };
+	u64 codePoints{ 0 };
+
+	// Lazily materialized contiguous version of the string
+	mutable std::optional<String> flat;
+
+public:
+	static constexpr u64 TChunkCapacity = 64 * 1024;
+
+	ChunkedString() = default;
+	ChunkedString(const String& s);
+
+	u64 bufferSize() const { return usedBytes + 1; }
+	u64 length() const { return codePoints; }
+	bool isEmpty() const { return !usedBytes; }
+
+	u64 chunkCount() const { return chunks.size(); }
+	bool isChunkShared(u64 chunkIdx) const { return chunks[chunkIdx].buffer.refCount() > 1; }
+
+	ChunkedString& append(const String& s);
+
+	Character charAt(u64 idx) const;
+	void setCharAt(u64 idx, Character c);
+
+	Character operator[](u64 idx) const { return charAt(idx); }
+
+	const String& toString() const;
+	const char* cString() const { return toString().cString(); }
+};
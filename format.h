@@ -0,0 +1,287 @@
+#pragma once
+
+#include <tuple>
+
+#include "string.h"
+
+// Format string with '{}' placeholders, where '{{' and '}}' are escaped braces. It is split
+// into the literal pieces between the placeholders with their code point counts. A plain
+// string is split while it is formatted. Wrap literals in COW_FORMAT to split them at
+// compile time, which also checks the number of arguments
+class FormatString {
+public:
+	struct Piece {
+		u64 begin{ 0 };
+		u64 end{ 0 };
+		u64 codePoints{ 0 };
+		bool isFollowedByArgument{ false };
+	};
+
+	constexpr FormatString(const char* s) : text(s), length(lengthOf(s)) {}
+
+	template<u64 NumPieces, u64 NumArguments>
+	constexpr FormatString(const ParsedFormatString<NumPieces, NumArguments>& p)
+		: text(p.text), length(p.length), pieces(p.pieces), numPieces(NumPieces) {}
+
+	constexpr const char* cString() const { return text; }
+	constexpr u64 argumentCount() const { return pieces ? countArguments(pieces, numPieces) : countArguments(text); }
+
+	// Calls the function with every piece in order
+	template<typename F>
+	constexpr void forEachPiece(F&& func) const {
+		if (!pieces) {
+			parse(text, length, func);
+			return;
+		}
+
+		for (u64 i = 0; i != numPieces; i++) {
+			func(pieces[i]);
+		}
+	}
+
+	static constexpr u64 countPieces(const char* s) {
+		u64 count = 0;
+		parse(s, lengthOf(s), [&](const Piece&) { count++; });
+		return count;
+	}
+
+	static constexpr u64 countArguments(const char* s) {
+		u64 count = 0;
+		parse(s, lengthOf(s), [&](const Piece& p) { count += p.isFollowedByArgument; });
+		return count;
+	}
+
+private:
+	template<u64 NumPieces, u64 NumArguments>
+	friend class ParsedFormatString;
+
+	static constexpr u64 lengthOf(const char* s) {
+		u64 length = 0;
+		while (s[length]) {
+			length++;
+		}
+		return length;
+	}
+
+	static constexpr u64 countArguments(const Piece* p, u64 count) {
+		u64 numArguments = 0;
+		for (u64 i = 0; i != count; i++) {
+			numArguments += p[i].isFollowedByArgument;
+		}
+		return numArguments;
+	}
+
+	template<typename F>
+	static constexpr void parse(const char* text, u64 length, F&& func) {
+		u64 begin = 0;
+		u64 i = 0;
+		while (i < length) {
+			auto isPlaceholder = text[i] == '{' && i + 1 < length && text[i + 1] == '}';
+			auto isEscape = (text[i] == '{' || text[i] == '}') && i + 1 < length && text[i + 1] == text[i];
+			if (!isPlaceholder && !isEscape) {
+				i++;
+				continue;
+			}
+
+			// Escaped braces keep the first one and skip the second one
+			func(makePiece(text, begin, isEscape ? i + 1 : i, isPlaceholder));
+			i += 2;
+			begin = i;
+		}
+		func(makePiece(text, begin, length, false));
+	}
+
+	static constexpr Piece makePiece(const char* text, u64 begin, u64 end, bool isFollowedByArgument) {
+		Piece p{};
+		p.begin = begin;
+		p.end = end;
+		p.isFollowedByArgument = isFollowedByArgument;
+		for (auto j = begin; j != end; j++) {
+			p.codePoints += ((u8)text[j] & 0xC0) != 0x80;
+		}
+		return p;
+	}
+
+	const char* text{ nullptr };
+	u64 length{ 0 };
+	const Piece* pieces{ nullptr };
+	u64 numPieces{ 0 };
+};
+
+// Format string literal split into exactly as many pieces as it has at compile time (see
+// COW_FORMAT). String::format checks that it gets one argument per placeholder
+template<u64 NumPieces, u64 NumArguments>
+class ParsedFormatString {
+public:
+	constexpr ParsedFormatString(const char* s) : text(s), length(FormatString::lengthOf(s)) {
+		u64 n = 0;
+		FormatString::parse(text, length, [&](const FormatString::Piece& p) { pieces[n++] = p; });
+	}
+
+	static constexpr u64 argumentCount() { return NumArguments; }
+
+private:
+	friend class FormatString;
+
+	const char* text;
+	u64 length;
+	FormatString::Piece pieces[NumPieces]{};
+};
+
+// Evaluates to the parsed format string literal, which lives in static storage
+#define COW_FORMAT(literal) ([]() -> const auto& { \
+		static constexpr ParsedFormatString<FormatString::countPieces(literal), FormatString::countArguments(literal)> parsed(literal); \
+		return parsed; \
+	}())
+
+// Formats an argument of type T for String::format. It is constructed from the argument
+// before anything is written, and has to know how many bytes and code points it writes.
+// Specialize it for custom types
+template<typename T, typename = void>
+class Formatter;
+
+template<>
+class Formatter<String> {
+public:
+	Formatter(const String& s) : ptr(s.cString()), numBytes(s.bufferSize() - 1), numCodePoints(s.length()) {}
+
+	u64 byteCount() const { return numBytes; }
+	u64 codePointCount() const { return numCodePoints; }
+	char* write(char* out) const {
+		memcpy(out, ptr, numBytes);
+		return out + numBytes;
+	}
+
+private:
+	const char* ptr;
+	u64 numBytes;
+	u64 numCodePoints;
+};
+
+template<>
+class Formatter<const char*> {
+public:
+	Formatter(const char* s) : ptr(s) {
+		numCodePoints = Character::countCodePointsInCString(s, &numBytes);
+	}
+
+	u64 byteCount() const { return numBytes; }
+	u64 codePointCount() const { return numCodePoints; }
+	char* write(char* out) const {
+		memcpy(out, ptr, numBytes);
+		return out + numBytes;
+	}
+
+private:
+	const char* ptr;
+	u64 numBytes;
+	u64 numCodePoints;
+};
+
+template<>
+class Formatter<char*> : public Formatter<const char*> {
+public:
+	using Formatter<const char*>::Formatter;
+};
+
+template<>
+class Formatter<Character> {
+public:
+	Formatter(Character c) : character(c) {}
+
+	u64 byteCount() const { return character.byteCount(); }
+	u64 codePointCount() const { return 1; }
+	char* write(char* out) const {
+		memcpy(out, character.bytes(), character.byteCount());
+		return out + character.byteCount();
+	}
+
+private:
+	Character character;
+};
+
+template<typename T>
+class Formatter<T, std::enable_if_t<isNumberType<T>>> {
+public:
+	// Numbers are formatted into the formatter, to know their size
+	Formatter(T value) {
+		numBytes = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr - buffer;
+	}
+
+	u64 byteCount() const { return numBytes; }
+	u64 codePointCount() const { return numBytes; }
+	char* write(char* out) const {
+		memcpy(out, buffer, numBytes);
+		return out + numBytes;
+	}
+
+private:
+	char buffer[32];
+	u64 numBytes;
+};
+
+template<typename... Args>
+String String::format(const FormatString& fmt, const Args&... args) {
+	// Let all arguments prepare themselves to get the exact size of the result
+	std::tuple<Formatter<std::decay_t<Args>>...> formatters{ args... };
+
+	u64 argumentBytes[sizeof...(Args) + 1]{};
+	u64 argumentCodePoints[sizeof...(Args) + 1]{};
+	std::apply([&](const auto&... f) {
+		u64 i = 0;
+		((argumentBytes[i] = f.byteCount(), argumentCodePoints[i++] = f.codePointCount()), ...);
+	}, formatters);
+
+	// Both passes go over the same pieces and arguments, even if their counts do not match
+	u64 numBytes = 1;
+	u64 numCodePoints = 0;
+	u64 argumentIdx = 0;
+	fmt.forEachPiece([&](const FormatString::Piece& p) {
+		numBytes += p.end - p.begin;
+		numCodePoints += p.codePoints;
+		if (p.isFollowedByArgument && argumentIdx < sizeof...(Args)) {
+			numBytes += argumentBytes[argumentIdx];
+			numCodePoints += argumentCodePoints[argumentIdx++];
+		}
+	});
+
+	// Write everything into a single buffer
+	String s;
+	if (numBytes > TSmallCapacity) {
+		s.ensureOwnedCapacity(numBytes);
+	}
+	auto begin = s.isSmall() ? (char*)s.data.bytes : (char*)s.dynBufferPointer();
+	auto out = begin;
+
+	argumentIdx = 0;
+	fmt.forEachPiece([&](const FormatString::Piece& p) {
+		memcpy(out, fmt.cString() + p.begin, p.end - p.begin);
+		out += p.end - p.begin;
+		if (p.isFollowedByArgument && argumentIdx < sizeof...(Args)) {
+			std::apply([&](const auto&... f) {
+				u64 i = 0;
+				((i++ == argumentIdx ? (void)(out = f.write(out)) : (void)0), ...);
+			}, formatters);
+			argumentIdx++;
+		}
+	});
+
+	assert((u64)(out - begin) + 1 == numBytes);
+	*out = '\0';
+	if (s.isSmall()) {
+		s.data.bytes[TSmallCapacity - 1] = (u8)(TSmallCapacity - numBytes);
+		s.data.bytes[numBytes - 1] = '\0';
+	}
+	else {
+		s.dyn().used = numBytes;
+		s.dyn().setCodePoints(numCodePoints);
+	}
+
+	return s;
+}
+
+template<u64 NumPieces, u64 NumArguments, typename... Args>
+String String::format(const ParsedFormatString<NumPieces, NumArguments>& fmt, const Args&... args) {
+	static_assert(NumArguments == sizeof...(Args), "String::format needs exactly one argument per placeholder");
+	return format(FormatString(fmt), args...);
+}
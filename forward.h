@@ -1,10 +1,33 @@
 #pragma once
 
+class BinaryText;
 class Character;
+class ChunkedString;
+class FormatString;
+class Hash;
+class LineReader;
+class OutputBatch;
+class Parallel;
+class PatternMatcher;
 class RefManager;
 class String;
+class StringInputBuffer;
+class StringInputStream;
 class StringIntrospection;
+class StringOutputBuffer;
+class StringOutputStream;
+class StringSort;
+class StringTable;
+class StringVector;
+class StringView;
 class Test;
+class Transcode;
+
+template<typename V>
+class StringMap;
+
+template<typename V>
+class StringTrie;
 
 template<typename T>
 class OwnPtr;
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstring>
+
+#include "util.h"
+
+class Hash {
+public:
+	// MurmurHash64A over a buffer of bytes
+	static u64 ofBuffer(const u8* ptr, u64 length, u64 seed = 0) {
+		constexpr u64 m = 0xc6a4a7935bd1e995ull;
+		constexpr int r = 47;
+
+		u64 h = seed ^ (length * m);
+		auto endPtr = ptr + (length & ~7ull);
+		while (ptr != endPtr) {
+			u64 k;
+			memcpy(&k, ptr, 8);
+			ptr += 8;
+
+			k *= m;
+			k ^= k >> r;
+			k *= m;
+
+			h ^= k;
+			h *= m;
+		}
+
+		// Mix in the remaining 0-7 bytes
+		auto tailLength = length & 7;
+		if (tailLength) {
+			u64 tail = 0;
+			memcpy(&tail, ptr, tailLength);
+			h ^= tail;
+			h *= m;
+		}
+
+		h ^= h >> r;
+		h *= m;
+		h ^= h >> r;
+		return h;
+	}
+};
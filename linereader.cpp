@@ -0,0 +1,121 @@
+
+#include <climits>
+#include <cstring>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "linereader.h"
+
+u64 LineReader::readInput(u8* ptr, u64 numBytes) {
+	if (file) {
+		return fread(ptr, 1, numBytes, file);
+	}
+
+#if defined(_WIN32)
+	auto cnt = _read(fileDescriptor, ptr, (unsigned int)std::min<u64>(numBytes, INT_MAX));
+#else
+	auto cnt = read(fileDescriptor, ptr, numBytes);
+#endif
+	return cnt > 0 ? (u64)cnt : 0;
+}
+
+bool LineReader::fillChunk() {
+	// Keep the incomplete line at the end of the chunk, which is moved into the next one
+	auto remaining = end - begin;
+
+	// Chunks need to be able to hold the whole line and its null byte. If the current chunk
+	// is not referenced by any lines anymore it is reused
+	if (!chunk || chunk.refCount() > 1 || chunk.ptr()->size() <= remaining * 2) {
+		auto newChunk = Shared<u8[]>::makeUninitialized(std::max(TChunkSize, remaining * 2 + 1));
+		if (remaining) {
+			memcpy(newChunk.ptr()->value, chunk.dataPtr() + begin, remaining);
+		}
+		chunk = std::move(newChunk);
+	}
+	else {
+		// The lines that were read from the chunk are gone, but it is written again
+		chunk.ptr()->dropAttachment();
+		if (remaining) {
+			memmove(chunk.dataPtr(), chunk.dataPtr() + begin, remaining);
+		}
+	}
+
+	begin = 0;
+	end = remaining;
+
+	// Leave a byte free for the null byte of the last line
+	auto cnt = readInput(chunk.dataPtr() + end, chunk.ptr()->size() - end - 1);
+	end += cnt;
+	return cnt > 0;
+}
+
+bool LineReader::readLine(String& line, bool reuseCapacity) {
+	// The previous line is replaced anyway. Letting go of its reference to the chunk allows
+	// the chunk to be reused when it is refilled
+	if (chunk && line.isDynamic() && line.dyn().buffer().ptr() == chunk.ptr()) {
+		line = String();
+	}
+
+	u8* newLinePtr = nullptr;
+	u64 searchBegin = begin;
+
+	while (true) {
+		// memchr is vectorized by the C library
+		if (chunk) {
+			newLinePtr = (u8*)memchr(chunk.dataPtr() + searchBegin, '\n', end - searchBegin);
+		}
+
+		if (newLinePtr || endOfInput) {
+			break;
+		}
+
+		// Do not search the bytes of the incomplete line again
+		auto searched = end - begin;
+		if (!fillChunk()) {
+			endOfInput = true;
+		}
+		searchBegin = begin + searched;
+	}
+
+	// The last line does not need to end with a line break
+	if (!newLinePtr && begin == end) {
+		return false;
+	}
+
+	auto linePtr = chunk.dataPtr() + begin;
+	auto lineEnd = newLinePtr ? (u64)(newLinePtr - chunk.dataPtr()) : end;
+	u64 len = lineEnd - begin + 1;
+
+	// Overwrite the line break to terminate the line right inside of the chunk
+	chunk.dataPtr()[lineEnd] = '\0';
+	auto offset = begin;
+	begin = newLinePtr ? lineEnd + 1 : end;
+
+	if (len <= String::TSmallCapacity) {
+		line = String((const char*)linePtr, len);
+		return true;
+	}
+
+	// Copy into the buffer the line already owns
+	if (reuseCapacity && line.isOwned() && line.dyn().buffer().ptr()->size() >= len) {
+		line.dropBufferAttachment();
+		memcpy(line.dyn().buffer().dataPtr(), linePtr, len);
+		line.dyn().offset = 0;
+		line.dyn().used = len;
+		line.resetCodePointsLitOrDyn();
+		return true;
+	}
+
+	if (reuseCapacity) {
+		line = String((const char*)linePtr, len);
+		return true;
+	}
+
+	line = String();
+	line.initAsSharedSlice(chunk, offset, len);
+	return true;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdio>
+
+#include "string.h"
+
+// Reads newline-delimited text from a file descriptor or FILE* in large chunks. Long lines
+// are returned as strings sharing the chunk buffer, short lines as small strings
+class LineReader {
+public:
+	static constexpr u64 TChunkSize = 64 * 1024;
+
+	explicit LineReader(int fd) : fileDescriptor(fd) {}
+	explicit LineReader(FILE* f) : file(f) {}
+
+	// Reads the next line without its line break. Returns false if there are no more lines
+	// By default long lines reference the chunk they were read into. If 'reuseCapacity' is set
+	// the line is instead copied into the buffer the string already owns if it is large enough
+	// A line still referencing the current chunk is released first, even if no line is left
+	bool readLine(String& line, bool reuseCapacity = false);
+
+private:
+	u64 readInput(u8* ptr, u64 numBytes);
+	bool fillChunk();
+
+	int fileDescriptor{ -1 };
+	FILE* file{ nullptr };
+	bool endOfInput{ false };
+
+	// Unread data is in range [begin, end) of the current chunk
+	SharedPtr<Shared<u8[]>> chunk;
+	u64 begin{ 0 };
+	u64 end{ 0 };
+};
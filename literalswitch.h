@@ -0,0 +1,184 @@
+#pragma once
+
+#include <cstring>
+#include <stdexcept>
+
+#include "string.h"
+#include "stringview.h"
+
+// Perfect hash over a fixed set of string literals, which is built at compile time.
+// Looking up a string takes one hash of its bytes and at most one memcmp, and returns
+// the index of the matching literal or the number of literals, to be used in a switch:
+//
+//   static constexpr LiteralSwitch commands("get", "set", "delete");
+//   switch (commands(s)) {
+//     case commands.indexOf("get"): ...
+//     default: ...
+//   }
+//
+// The literals are hashed into buckets, and every bucket gets an xor displacement that
+// moves its literals into free slots of the table (hash and displace)
+template<u64 Count>
+class LiteralSwitch {
+private:
+	static constexpr u64 tableSizeFor(u64 count) {
+		u64 size = 8;
+		while (size < 2 * count) {
+			size *= 2;
+		}
+		return size;
+	}
+
+	static constexpr u64 TTableSize = tableSizeFor(Count);
+	static constexpr u64 TBucketCount = Count / 2 + 1;
+
+	template<typename T>
+	static constexpr u64 hashBytes(const T* ptr, u64 length, u64 seed) {
+		// FNV-1a with a seed, whose high bits are mixed into the low ones in the end
+		u64 h = 14695981039346656037ull ^ (seed * 0x9E3779B97F4A7C15ull);
+		for (u64 i = 0; i != length; i++) {
+			h ^= (u8)ptr[i];
+			h *= 1099511628211ull;
+		}
+		return h ^ (h >> 29);
+	}
+
+	static constexpr u64 bucketOf(u64 hash) { return (hash >> 40) % TBucketCount; }
+
+	constexpr bool tryBuild(u64 seed) {
+		for (auto& slot : table) {
+			slot = 0;
+		}
+
+		u64 hashes[Count]{};
+		u64 bucketSizes[TBucketCount]{};
+		for (u64 i = 0; i != Count; i++) {
+			hashes[i] = hashBytes(literals[i], lengths[i], seed);
+			bucketSizes[bucketOf(hashes[i])]++;
+		}
+
+		// Place the largest buckets first, while the table is still empty
+		bool placed[TBucketCount]{};
+		for (u64 n = 0; n != TBucketCount; n++) {
+			u64 bucket = 0;
+			for (u64 b = 0; b != TBucketCount; b++) {
+				if (!placed[b] && (placed[bucket] || bucketSizes[b] > bucketSizes[bucket])) {
+					bucket = b;
+				}
+			}
+			placed[bucket] = true;
+
+			bool found = false;
+			for (u64 d = 0; d != TTableSize && !found; d++) {
+				found = true;
+				for (u64 i = 0; i != Count && found; i++) {
+					if (bucketOf(hashes[i]) != bucket) {
+						continue;
+					}
+
+					// Also fails if two literals of the bucket need the same slot
+					auto& slot = table[(hashes[i] ^ d) & (TTableSize - 1)];
+					if (slot) {
+						found = false;
+						break;
+					}
+					slot = (u16)(i + 1);
+				}
+
+				// Undo the partially placed bucket
+				if (!found) {
+					for (u64 i = 0; i != Count; i++) {
+						if (bucketOf(hashes[i]) == bucket && table[(hashes[i] ^ d) & (TTableSize - 1)] == i + 1) {
+							table[(hashes[i] ^ d) & (TTableSize - 1)] = 0;
+						}
+					}
+				}
+				else {
+					displacements[bucket] = (u16)d;
+				}
+			}
+
+			if (!found) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	constexpr bool hasDuplicates() const {
+		for (u64 i = 0; i != Count; i++) {
+			for (u64 j = i + 1; j != Count; j++) {
+				bool equal = lengths[i] == lengths[j];
+				for (u64 k = 0; k != lengths[i] && equal; k++) {
+					equal = literals[i][k] == literals[j][k];
+				}
+				if (equal) {
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	constexpr u64 lookup(const char* ptr, u64 length) const {
+		auto hash = hashBytes(ptr, length, seed);
+		auto idx = table[(hash ^ displacements[bucketOf(hash)]) & (TTableSize - 1)];
+		if (!idx || lengths[idx - 1] != length) {
+			return Count;
+		}
+
+		for (u64 i = 0; i != length; i++) {
+			if (literals[idx - 1][i] != ptr[i]) {
+				return Count;
+			}
+		}
+		return idx - 1;
+	}
+
+	const char* literals[Count]{};
+	u64 lengths[Count]{};
+	u64 seed{ 0 };
+	u16 displacements[TBucketCount]{};
+	u16 table[TTableSize]{};
+
+public:
+	static_assert(Count > 0 && Count < 0xFFFF, "Invalid number of literals");
+
+	template<unsigned int... N>
+	constexpr LiteralSwitch(const char(&... s)[N]) : literals{ s... }, lengths{ (N - 1)... } {
+		// Two equal literals can never be placed in different slots. The constructor arguments
+		// cannot be checked by a static_assert, but throwing fails the constant evaluation with
+		// this message instead of searching for a seed forever
+		if (hasDuplicates()) {
+			throw std::invalid_argument("LiteralSwitch: Every literal may only appear once");
+		}
+
+		while (!tryBuild(seed)) {
+			seed++;
+		}
+	}
+
+	static constexpr u64 caseCount() { return Count; }
+
+	// Usable as a case label
+	template<unsigned int N>
+	constexpr u64 indexOf(const char(&s)[N]) const {
+		return lookup(s, N - 1);
+	}
+
+	u64 operator()(StringView v) const {
+		auto hash = hashBytes(v.data(), v.byteCount(), seed);
+		auto idx = table[(hash ^ displacements[bucketOf(hash)]) & (TTableSize - 1)];
+		if (!idx || lengths[idx - 1] != v.byteCount() || memcmp(literals[idx - 1], v.data(), v.byteCount())) {
+			return Count;
+		}
+		return idx - 1;
+	}
+
+	u64 operator()(const String& s) const { return (*this)(StringView(s)); }
+	u64 operator()(const char* s) const { return (*this)(StringView(s)); }
+};
+
+template<unsigned int... N>
+LiteralSwitch(const char(&... s)[N]) -> LiteralSwitch<sizeof...(N)>;
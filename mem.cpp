@@ -0,0 +1,199 @@
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <malloc.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "mem.h"
+
+void* Memory::allocateAligned(u64 numBytes, u64 alignment, u64* usableBytes) {
+#if defined(_WIN32)
+	void* ptr = _aligned_malloc(numBytes, alignment);
+#else
+	void* ptr = nullptr;
+	if (posix_memalign(&ptr, alignment, numBytes)) {
+		ptr = nullptr;
+	}
+#endif
+
+	if (!ptr) {
+		throw std::bad_alloc();
+	}
+
+	if (usableBytes) {
+#if defined(_WIN32)
+		*usableBytes = _aligned_msize(ptr, alignment, 0);
+#elif defined(__APPLE__)
+		*usableBytes = malloc_size(ptr);
+#else
+		*usableBytes = malloc_usable_size(ptr);
+#endif
+	}
+
+	return ptr;
+}
+
+void Memory::freeAligned(void* ptr) {
+#if defined(_WIN32)
+	_aligned_free(ptr);
+#else
+	free(ptr);
+#endif
+}
+
+u64 Memory::pageSize() {
+#if defined(_WIN32)
+	static const u64 size = [] {
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+		return (u64)info.dwPageSize;
+	}();
+#else
+	static const u64 size = (u64)sysconf(_SC_PAGESIZE);
+#endif
+	return size;
+}
+
+static u64 roundUpToPages(u64 numBytes) {
+	auto page = Memory::pageSize();
+	return (numBytes + page - 1) / page * page;
+}
+
+void* Memory::allocatePages(u64 numBytes, u64* usableBytes) {
+	auto size = roundUpToPages(numBytes);
+
+#if defined(_WIN32)
+	void* ptr = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+	if (!ptr) {
+		throw std::bad_alloc();
+	}
+#else
+	void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (ptr == MAP_FAILED) {
+		throw std::bad_alloc();
+	}
+#endif
+
+	*usableBytes = size;
+	return ptr;
+}
+
+void* Memory::reallocatePages(void* ptr, u64 oldNumBytes, u64 newNumBytes, u64* usableBytes) {
+	auto oldSize = roundUpToPages(oldNumBytes);
+	auto newSize = roundUpToPages(newNumBytes);
+	if (oldSize == newSize) {
+		*usableBytes = oldSize;
+		return ptr;
+	}
+
+#if defined(__linux__)
+	// Let the kernel move the page table entries instead of copying the data
+	void* newPtr = mremap(ptr, oldSize, newSize, MREMAP_MAYMOVE);
+	if (newPtr == MAP_FAILED) {
+		throw std::bad_alloc();
+	}
+
+	*usableBytes = newSize;
+	return newPtr;
+#else
+	// No remapping available -> copy the pages over
+	void* newPtr = allocatePages(newSize, usableBytes);
+	memcpy(newPtr, ptr, std::min(oldSize, newSize));
+	freePages(ptr, oldSize);
+	return newPtr;
+#endif
+}
+
+void Memory::freePages(void* ptr, u64 numBytes) {
+#if defined(_WIN32)
+	VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+	munmap(ptr, roundUpToPages(numBytes));
+#endif
+}
+
+void* Memory::mapFile(const char* path, u64 headerSize, u64* fileSize) {
+	auto headerPages = roundUpToPages(headerSize);
+
+#if defined(_WIN32)
+	// Windows cannot map a file directly behind other memory -> read it into mapped pages instead
+	auto file = fopen(path, "rb");
+	if (!file) {
+		return nullptr;
+	}
+
+	fseek(file, 0, SEEK_END);
+	u64 size = (u64)_ftelli64(file);
+	fseek(file, 0, SEEK_SET);
+
+	u64 usable;
+	auto base = (u8*)allocatePages(headerPages + size + 1, &usable);
+	if (fread(base + headerPages, 1, size, file) != size) {
+		freePages(base, usable);
+		fclose(file);
+		return nullptr;
+	}
+	fclose(file);
+	base[headerPages + size] = '\0';
+#else
+	int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		return nullptr;
+	}
+
+	struct stat info;
+	if (fstat(fd, &info)) {
+		close(fd);
+		return nullptr;
+	}
+	u64 size = (u64)info.st_size;
+
+	// Reserve zero initialized pages for the header, the file and at least one zero byte after
+	// it. Then the file is mapped over the middle, so it directly follows the header
+	auto totalSize = headerPages + roundUpToPages(size + 1);
+	auto base = (u8*)mmap(nullptr, totalSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (base == MAP_FAILED) {
+		close(fd);
+		throw std::bad_alloc();
+	}
+
+	if (size && mmap(base + headerPages, size, PROT_READ, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+		munmap(base, totalSize);
+		close(fd);
+		return nullptr;
+	}
+	close(fd);
+#endif
+
+	*fileSize = size;
+	return base + headerPages - headerSize;
+}
+
+void Memory::unmapFile(void* ptr, u64 headerSize, u64 fileSize) {
+	auto headerPages = roundUpToPages(headerSize);
+	auto base = (u8*)ptr + headerSize - headerPages;
+
+#if defined(_WIN32)
+	freePages(base, headerPages + fileSize + 1);
+#else
+	munmap(base, headerPages + roundUpToPages(fileSize + 1));
+#endif
+}
@@ -2,6 +2,8 @@
 
 // TODO: Remove this and the debug messages:
 #include <iostream>
+#include <new>
+#include <type_traits>
 
 #include "forward.h"
 #include "util.h"
@@ -71,6 +73,34 @@ private:
 
 namespace Memory {
 
+	// Alignment of the data inside of shared array buffers, large enough for 256bit SIMD loads
+	constexpr u64 BufferAlignment = 32;
+
+	// Allocates raw memory with the requested alignment. If 'usableBytes' is provided, it receives
+	// the number of bytes actually usable, which might be more than requested (allocator slack)
+	void* allocateAligned(u64 numBytes, u64 alignment, u64* usableBytes = nullptr);
+	void freeAligned(void* ptr);
+
+	// Maps whole pages of memory directly from the OS. Mapped memory can be resized without
+	// copying its contents, as the pages are just remapped to a (possibly different) address
+	u64 pageSize();
+	void* allocatePages(u64 numBytes, u64* usableBytes);
+	void* reallocatePages(void* ptr, u64 oldNumBytes, u64 newNumBytes, u64* usableBytes);
+	void freePages(void* ptr, u64 numBytes);
+
+	// Maps the contents of a file read-only, with 'headerSize' writable bytes right in front of
+	// them and at least one zero byte following them. Returns a pointer to the header or nullptr
+	// if the file could not be opened
+	void* mapFile(const char* path, u64 headerSize, u64* fileSize);
+	void unmapFile(void* ptr, u64 headerSize, u64 fileSize);
+
+	// How the memory of a shared array was obtained
+	enum class Storage : u32 {
+		Heap,
+		Mapped,
+		File
+	};
+
 	// Deletes an object
 	template<typename T>
 	struct ObjectDeleter {
@@ -152,48 +182,155 @@ public:
 	T value;
 };
 
+// Data derived from the contents of a shared array (eg. an index), which is kept with the
+// array and destroyed together with it
+class SharedAttachment {
+public:
+	virtual ~SharedAttachment() = default;
+};
+
 // Wraps an array of object and makes it ref-counted
 template<typename T>
 class Shared<T[]> : public RefCounted<Shared<T[]>> {
 private:
-	Shared(u64 sz) : itemCount(sz) {
+	struct UninitializedTag {};
+
+	Shared(u64 sz) : itemCount(sz), storage(Memory::Storage::Heap) {
 		// Construct all objects with their default (not POD-value) constructor
 		for (u64 i = 0; i != itemCount; i++) {
 			new(value + i) T;
 		}
 	}
 
+	Shared(u64 sz, Memory::Storage st, UninitializedTag) : itemCount(sz), storage(st) {}
+
+	u64 allocationSize() const { return sizeof(Shared<T[]>) + sizeof(T) * itemCount; }
 
 public:
 	~Shared() {
 		// Destruct all objects
-		for (u64 i = 0; i != itemCount; i++) {
-			value[i].~T();
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			for (u64 i = 0; i != itemCount; i++) {
+				value[i].~T();
+			}
 		}
 	}
 
 	static OwnPtr<Shared<T[]>> make(u64 cnt) {
 		auto size = sizeof(Shared<T[]>) + sizeof(T) * cnt; std::cout << "Alloc " << size << " bytes of memory\n";
-		auto mem = new u8[size];
+		auto mem = Memory::allocateAligned(size, alignof(Shared<T[]>));
 		auto obj = new(mem) Shared<T[]>(cnt);
 
 		return OwnPtr<Shared<T[]>>(obj);
 	}
 
+	// Allocates an array of at least 'minCnt' items without constructing them. Any slack
+	// the allocator hands out is added to the item count, so it can be used right away
+	static OwnPtr<Shared<T[]>> makeUninitialized(u64 minCnt) {
+		static_assert(std::is_trivial_v<T>, "Only trivial types may be left uninitialized");
+
+		u64 usable;
+		auto size = sizeof(Shared<T[]>) + sizeof(T) * minCnt;
+		auto mem = Memory::allocateAligned(size, alignof(Shared<T[]>), &usable);
+		auto obj = new(mem) Shared<T[]>((usable - sizeof(Shared<T[]>)) / sizeof(T), Memory::Storage::Heap, UninitializedTag{});
+
+		return OwnPtr<Shared<T[]>>(obj);
+	}
+
+	// Allocates an uninitialized array of at least 'minCnt' items as pages mapped from the OS
+	// Used for huge arrays, as they can grow in place via 'growMapped'
+	static OwnPtr<Shared<T[]>> makeMapped(u64 minCnt) {
+		static_assert(std::is_trivial_v<T>, "Only trivial types may be left uninitialized");
+
+		u64 usable;
+		auto size = sizeof(Shared<T[]>) + sizeof(T) * minCnt;
+		auto mem = Memory::allocatePages(size, &usable);
+		auto obj = new(mem) Shared<T[]>((usable - sizeof(Shared<T[]>)) / sizeof(T), Memory::Storage::Mapped, UninitializedTag{});
+
+		return OwnPtr<Shared<T[]>>(obj);
+	}
+
+	// Grows a mapped array to at least 'minCnt' items by remapping its pages. The contents are
+	// not copied, but the array might end up at a different address. If remapping fails 'p'
+	// still owns the array when the exception leaves
+	static OwnPtr<Shared<T[]>> growMapped(OwnPtr<Shared<T[]>>&& p, u64 minCnt) {
+		auto obj = p.ptr();
+		assert(obj && obj->isMapped());
+
+		u64 usable;
+		auto size = sizeof(Shared<T[]>) + sizeof(T) * minCnt;
+		auto mem = Memory::reallocatePages(obj, obj->allocationSize(), size, &usable);
+		p.release();
+		obj = (Shared<T[]>*)mem;
+		obj->itemCount = (usable - sizeof(Shared<T[]>)) / sizeof(T);
+
+		return OwnPtr<Shared<T[]>>(obj);
+	}
+
+	// Makes a read-only array of the bytes of a file, followed by a zero byte which is counted as
+	// an item. The file is mapped into memory and not copied. Returns nullptr if it cannot be opened
+	static OwnPtr<Shared<T[]>> makeFromFile(const char* path) {
+		static_assert(sizeof(T) == 1, "Files are mapped as arrays of bytes");
+
+		u64 fileSize;
+		auto mem = Memory::mapFile(path, sizeof(Shared<T[]>), &fileSize);
+		if (!mem) {
+			return OwnPtr<Shared<T[]>>(nullptr);
+		}
+
+		auto obj = new(mem) Shared<T[]>(fileSize + 1, Memory::Storage::File, UninitializedTag{});
+		return OwnPtr<Shared<T[]>>(obj);
+	}
+
+	static void destroy(Shared<T[]>* obj) {
+		auto st = obj->storage;
+		auto size = obj->allocationSize();
+		obj->~Shared();
+
+		switch (st) {
+		case Memory::Storage::Heap:
+			Memory::freeAligned(obj);
+			return;
+		case Memory::Storage::Mapped:
+			Memory::freePages(obj, size);
+			return;
+		case Memory::Storage::File:
+			Memory::unmapFile(obj, sizeof(Shared<T[]>), size - sizeof(Shared<T[]>) - 1);
+			return;
+		}
+	}
+
+	bool isMapped() const { return storage == Memory::Storage::Mapped; }
+	bool isReadOnly() const { return storage == Memory::Storage::File; }
+
 	T& operator[] (u64 idx) { assert(idx < itemCount); return value[idx]; }
 	const T& operator[] (u64 idx) const { assert(idx < itemCount);  return value[idx]; }
 
 	u64 size() const { return itemCount; }
 
+	// Whoever writes to contents that might have been read before has to drop the attachment,
+	// as it could be outdated afterwards. It fits into the padding of the header
+	SharedAttachment* attachment() const { return attached.ptr(); }
+	void attach(OwnPtr<SharedAttachment>&& a) const { attached.reset(a.release()); }
+	void dropAttachment() const { attached.reset(); }
+
 private:
-	const u64 itemCount;
+	u64 itemCount;
+	const Memory::Storage storage;
+	mutable OwnPtr<SharedAttachment> attached{ nullptr };
 
 public:
-	T value[]; // The space following is the actual array of objects
+	alignas(Memory::BufferAlignment) T value[]; // The space following is the actual array of objects
 };
 
 namespace Memory {
 
+	// Shared arrays are allocated as raw aligned memory and need to be freed accordingly
+	template<typename T>
+	struct ObjectDeleter<Shared<T[]>> {
+		void operator()(Shared<T[]>* obj) const { Shared<T[]>::destroy(obj); }
+	};
+
 	// Base class of all shared pointers
 	template<typename T>
 	class SharedPtrBase : public RefManager {
@@ -217,7 +354,8 @@ namespace Memory {
 		void reset(T* n = nullptr) {
 			if (obj) {
 				if (!unref(*obj)) {
-					delete obj;
+					ObjectDeleter<T> del;
+					del(obj);
 				}
 			}
 
@@ -240,14 +378,18 @@ namespace Memory {
 			return obj ? RefManager::refCount(*obj) : 0;
 		}
 
+		// Takes the object out of the pointer, if it is the only reference to it
 		OwnPtr<T> tryOwning() {
 			if (refCount() > 1) {
-				return {};
+				return OwnPtr<T>(nullptr);
 			}
 
 			T* p = obj;
+			if (p) {
+				unref(*p);
+			}
 			obj = nullptr;
-			return { p };
+			return OwnPtr<T>(p);
 		}
 
 		operator bool() const { return static_cast<bool>(obj); }
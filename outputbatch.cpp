@@ -0,0 +1,118 @@
+
+#include <cerrno>
+#include <climits>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include "outputbatch.h"
+
+OutputBatch& OutputBatch::add(const String& s) {
+	// Copying references the buffer of dynamic strings instead of copying the text
+	numBytes += s.bufferSize() - 1;
+	pieces.push_back(s);
+	return *this;
+}
+
+OutputBatch& OutputBatch::add(String&& s) {
+	numBytes += s.bufferSize() - 1;
+	pieces.push_back(std::move(s));
+	return *this;
+}
+
+bool OutputBatch::writeTo(int fd) {
+	return write(fd, {});
+}
+
+bool OutputBatch::writeTo(int fd, u64 fileOffset) {
+	return write(fd, fileOffset);
+}
+
+void OutputBatch::clear() {
+	pieces.clear();
+	numBytes = 0;
+}
+
+#if defined(_WIN32)
+
+bool OutputBatch::write(int fd, std::optional<u64> fileOffset) {
+	// There is no vectored write for file descriptors -> write piece by piece
+	if (fileOffset && _lseeki64(fd, (long long)*fileOffset, SEEK_SET) < 0) {
+		return false;
+	}
+
+	for (auto& s : pieces) {
+		auto ptr = s.cString();
+		u64 left = s.bufferSize() - 1;
+		while (left) {
+			auto cnt = _write(fd, ptr, (unsigned int)std::min<u64>(left, INT_MAX));
+			if (cnt <= 0) {
+				return false;
+			}
+			ptr += cnt;
+			left -= cnt;
+		}
+	}
+
+	return true;
+}
+
+#else
+
+bool OutputBatch::write(int fd, std::optional<u64> fileOffset) {
+	// The io vectors are only created now, as the bytes of small strings move with the pieces vector
+	std::vector<iovec> vectors;
+	vectors.reserve(pieces.size());
+	for (auto& s : pieces) {
+		if (!s.isEmpty()) {
+			vectors.push_back({ (void*)s.cString(), (size_t)(s.bufferSize() - 1) });
+		}
+	}
+
+	u64 offset = fileOffset ? *fileOffset : 0;
+	u64 idx = 0;
+	while (idx < vectors.size()) {
+		auto cnt = (int)std::min<u64>(vectors.size() - idx, IOV_MAX);
+
+		ssize_t written;
+		if (!fileOffset) {
+			written = writev(fd, vectors.data() + idx, cnt);
+		}
+		else {
+#if defined(__linux__) || defined(__FreeBSD__)
+			written = pwritev(fd, vectors.data() + idx, cnt, (off_t)offset);
+#else
+			written = pwrite(fd, vectors[idx].iov_base, vectors[idx].iov_len, (off_t)offset);
+#endif
+		}
+
+		if (written < 0 && errno == EINTR) {
+			continue;
+		}
+
+		if (written <= 0) {
+			return false;
+		}
+
+		// Skip the completely written pieces and continue inside of a partially written one
+		u64 left = (u64)written;
+		offset += left;
+		while (idx < vectors.size() && left >= vectors[idx].iov_len) {
+			left -= vectors[idx].iov_len;
+			idx++;
+		}
+
+		if (left) {
+			vectors[idx].iov_base = (u8*)vectors[idx].iov_base + left;
+			vectors[idx].iov_len -= left;
+		}
+	}
+
+	return true;
+}
+
+#endif
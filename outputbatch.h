@@ -0,0 +1,31 @@
+#pragma once
+
+#include <vector>
+
+#include "string.h"
+
+// Collects strings to be written with a single vectored write (writev) instead of
+// concatenating them first. The batch keeps a reference to the buffer of every piece
+// until it is cleared, so they stay valid while being written
+class OutputBatch {
+public:
+	OutputBatch& add(const String& s);
+	OutputBatch& add(String&& s);
+
+	u64 pieceCount() const { return pieces.size(); }
+	u64 byteCount() const { return numBytes; }
+	bool isEmpty() const { return !numBytes; }
+
+	// Writes all pieces to the file descriptor, at the current position or at a file
+	// offset (pwritev). Partial writes are continued. Returns false if writing failed
+	bool writeTo(int fd);
+	bool writeTo(int fd, u64 fileOffset);
+
+	void clear();
+
+private:
+	bool write(int fd, std::optional<u64> fileOffset);
+
+	std::vector<String> pieces;
+	u64 numBytes{ 0 };
+};
@@ -0,0 +1,195 @@
+
+#include <atomic>
+#include <thread>
+
+#include "parallel.h"
+#include "simd.h"
+#include "transcode.h"
+
+// Smaller inputs are not worth starting threads for
+static constexpr u64 TParallelBytes = 1 << 20;
+static constexpr u64 TParallelStrings = 1 << 12;
+
+// There are more chunks than threads, so that the threads which finish early take over
+// the chunks of the slower ones
+static constexpr u64 TChunksPerThread = 4;
+
+static u64 threadCount() {
+	return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// The threads take the chunks one by one in order
+template<typename F>
+static void forEachChunk(u64 numChunks, F&& work) {
+	std::atomic<u64> nextChunk{ 0 };
+	auto worker = [&] {
+		for (u64 idx; (idx = nextChunk++) < numChunks;) {
+			work(idx);
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (u64 i = 1; i < std::min(threadCount(), numChunks); i++) {
+		threads.emplace_back(worker);
+	}
+	worker();
+	for (auto& t : threads) {
+		t.join();
+	}
+}
+
+// Returns the bounds of the chunks, which are moved forward to the next leading byte
+static std::vector<u64> splitText(const u8* ptr, u64 length) {
+	auto numChunks = length >= TParallelBytes ? threadCount() * TChunksPerThread : 1;
+	std::vector<u64> bounds{ 0 };
+	for (u64 i = 1; i < numChunks; i++) {
+		auto bound = std::max(length / numChunks * i, bounds.back());
+		while (bound < length && (ptr[bound] & 0xC0) == 0x80) {
+			bound++;
+		}
+		bounds.push_back(bound);
+	}
+	bounds.push_back(length);
+	return bounds;
+}
+
+// Only matches Character::countCodePointsInBuffer, which String::length uses, for valid
+// text. Broken sequences are counted differently
+static u64 countLeadingBytes(const u8* ptr, u64 length) {
+	u64 count = 0;
+	u64 i = 0;
+	for (; length - i >= Simd::TGroupSize; i += Simd::TGroupSize) {
+		count += Simd::TGroupSize - Simd::popCount(Simd::continuationMask(ptr + i));
+	}
+	for (; i < length; i++) {
+		count += (ptr[i] & 0xC0) != 0x80;
+	}
+	return count;
+}
+
+u64 Parallel::length(const String& s) {
+	if (s.isSmall() || s.hasCachedCodePointsLitOrDyn()) {
+		return s.length();
+	}
+
+	auto ptr = (const u8*)s.cString();
+	auto bounds = splitText(ptr, s.bufferSize() - 1);
+	std::vector<u64> counts(bounds.size() - 1);
+	std::atomic<bool> isValid{ true };
+	forEachChunk(counts.size(), [&](u64 idx) {
+		auto chunk = ptr + bounds[idx];
+		auto chunkLength = bounds[idx + 1] - bounds[idx];
+		if (!isValid || !Transcode::isValidUtf8(chunk, chunkLength)) {
+			isValid = false;
+			return;
+		}
+		counts[idx] = countLeadingBytes(chunk, chunkLength);
+	});
+
+	// Broken text is counted one character after the other like String::length does, as
+	// the chunks cannot be counted on their own
+	if (!isValid) {
+		return s.length();
+	}
+
+	u64 numCodePoints = 0;
+	for (auto count : counts) {
+		numCodePoints += count;
+	}
+
+	if (s.isLiteral()) {
+		s.lit().cacheCodePoints(numCodePoints);
+	}
+	else {
+		s.dyn().cacheCodePoints(numCodePoints);
+	}
+	return numCodePoints;
+}
+
+bool Parallel::isValidUtf8(const String& s) {
+	auto ptr = (const u8*)s.cString();
+	auto bounds = splitText(ptr, s.isEmpty() ? 0 : s.bufferSize() - 1);
+	std::atomic<bool> isValid{ true };
+	forEachChunk(bounds.size() - 1, [&](u64 idx) {
+		if (isValid && !Transcode::isValidUtf8(ptr + bounds[idx], bounds[idx + 1] - bounds[idx])) {
+			isValid = false;
+		}
+	});
+	return isValid;
+}
+
+std::optional<u64> Parallel::find(const String& s, StringView needle) {
+	auto ptr = (const u8*)s.cString();
+	auto length = s.isEmpty() ? 0 : s.bufferSize() - 1;
+	auto needleLength = needle.byteCount();
+	if (!needleLength) {
+		return 0;
+	}
+	if (needleLength > length) {
+		return {};
+	}
+
+	// Every chunk looks for matches that start inside of it, which may reach into the next
+	// chunk. Chunks behind the first found match are skipped
+	auto bounds = splitText(ptr, length);
+	auto lastStart = length - needleLength;
+	auto firstByte = (u8)needle.data()[0];
+	std::atomic<u64> firstMatch{ length };
+	forEachChunk(bounds.size() - 1, [&](u64 idx) {
+		auto i = bounds[idx];
+		auto end = std::min(bounds[idx + 1], lastStart + 1);
+		while (i < end && i < firstMatch) {
+			if (end - i >= Simd::TGroupSize) {
+				auto mask = Simd::equalMask(ptr + i, firstByte);
+				if (!mask) {
+					i += Simd::TGroupSize;
+					continue;
+				}
+				i += Simd::countTrailingZeros(mask);
+			}
+
+			if (ptr[i] == firstByte && !memcmp(ptr + i, needle.data(), needleLength)) {
+				// Only an earlier match may replace the found one
+				auto found = firstMatch.load();
+				while (i < found && !firstMatch.compare_exchange_weak(found, i)) {}
+				return;
+			}
+			i++;
+		}
+	});
+
+	if (firstMatch == length) {
+		return {};
+	}
+	return firstMatch.load();
+}
+
+template<typename F>
+static std::vector<u64> forEachString(const String* begin, const String* end, F&& compute) {
+	u64 count = end - begin;
+	std::vector<u64> results(count);
+	auto numChunks = count >= TParallelStrings ? threadCount() * TChunksPerThread : 1;
+	forEachChunk(numChunks, [&](u64 idx) {
+		for (auto i = count / numChunks * idx, last = idx + 1 == numChunks ? count : count / numChunks * (idx + 1); i < last; i++) {
+			results[i] = compute(begin[i]);
+		}
+	});
+	return results;
+}
+
+std::vector<u64> Parallel::lengthAll(const String* begin, const String* end) {
+	return forEachString(begin, end, [](const String& s) {
+		if (s.isSmall() || s.hasCachedCodePointsLitOrDyn()) {
+			return s.length();
+		}
+		auto ptr = (const u8*)s.cString();
+		auto length = s.bufferSize() - 1;
+		return Transcode::isValidUtf8(ptr, length) ? countLeadingBytes(ptr, length) : Character::countCodePointsInBuffer(ptr, length);
+	});
+}
+
+std::vector<u64> Parallel::hashAll(const String* begin, const String* end) {
+	return forEachString(begin, end, [](const String& s) {
+		return s.hash();
+	});
+}
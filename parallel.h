@@ -0,0 +1,33 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "string.h"
+#include "stringview.h"
+
+// Bulk operations that split one large string, or a span of strings, across threads and
+// combine the partial results. Text is split at code point boundaries. The threads only
+// read, so they are safe with shared buffers whose reference counts are not atomic. Small
+// inputs are done on the calling thread
+class Parallel {
+public:
+	// Same as String::length for valid UTF-8. The count is cached on the calling thread
+	static u64 length(const String& s);
+	static bool isValidUtf8(const String& s);
+
+	// Returns the byte offset of the first occurrence of the needle
+	static std::optional<u64> find(const String& s, StringView needle);
+
+	// Cached code point counts are used but not written
+	static std::vector<u64> lengthAll(const String* begin, const String* end);
+	static std::vector<u64> hashAll(const String* begin, const String* end);
+
+	static std::vector<u64> lengthAll(const std::vector<String>& strings) {
+		return lengthAll(strings.data(), strings.data() + strings.size());
+	}
+
+	static std::vector<u64> hashAll(const std::vector<String>& strings) {
+		return hashAll(strings.data(), strings.data() + strings.size());
+	}
+};
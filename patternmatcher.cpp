@@ -0,0 +1,194 @@
+
+#include <cstring>
+#include <queue>
+
+#include "patternmatcher.h"
+#include "simd.h"
+
+PatternMatcher::PatternMatcher(const std::vector<String>& strings) {
+	for (auto& s : strings) {
+		patterns.emplace_back(s.cString(), s.bufferSize() - 1);
+	}
+	build();
+}
+
+PatternMatcher::PatternMatcher(std::initializer_list<StringView> views) {
+	for (auto& v : views) {
+		patterns.emplace_back((const char*)v.data(), v.byteCount());
+	}
+	build();
+}
+
+void PatternMatcher::build() {
+	// Empty patterns keep their index, but are never added to the prefilter or automaton
+	u64 numPatterns = 0;
+	for (u32 i = 0; i != patterns.size(); i++) {
+		if (patterns[i].empty()) {
+			continue;
+		}
+
+		numPatterns++;
+		auto byte = (u8)patterns[i][0];
+		auto it = std::find(firstBytes.begin(), firstBytes.end(), byte);
+		if (it == firstBytes.end()) {
+			firstBytes.push_back(byte);
+			patternsByFirstByte.emplace_back();
+			it = firstBytes.end() - 1;
+		}
+		patternsByFirstByte[it - firstBytes.begin()].push_back(i);
+	}
+
+	if (numPatterns <= TMaxPrefilterPatterns && firstBytes.size() <= TMaxPrefilterFirstBytes) {
+		return;
+	}
+
+	// Bytes which do not appear in any pattern share class 0
+	for (auto& p : patterns) {
+		for (auto c : p) {
+			auto& cls = byteClasses[(u8)c];
+			if (!cls) {
+				cls = (u16)++numClasses;
+			}
+		}
+	}
+	numClasses++;
+
+	// Build the trie, where 0 means there is no edge as no edge leads back to the root
+	transitions.assign(numClasses, 0);
+	outputs.emplace_back();
+	for (u32 i = 0; i != patterns.size(); i++) {
+		if (patterns[i].empty()) {
+			continue;
+		}
+
+		u32 state = 0;
+		for (auto c : patterns[i]) {
+			auto& next = transitions[state * numClasses + byteClasses[(u8)c]];
+			if (!next) {
+				next = (u32)outputs.size();
+				outputs.emplace_back();
+				transitions.resize(transitions.size() + numClasses, 0);
+			}
+			state = transitions[state * numClasses + byteClasses[(u8)c]];
+		}
+		outputs[state].push_back(i);
+	}
+
+	// Add the failure transitions breadth first, so every state becomes a complete DFA row
+	std::vector<u32> failure(outputs.size(), 0);
+	outputLinks.assign(outputs.size(), 0);
+	std::queue<u32> queue;
+	for (u64 c = 0; c != numClasses; c++) {
+		if (auto child = transitions[c]) {
+			queue.push(child);
+		}
+	}
+
+	while (!queue.empty()) {
+		auto state = queue.front();
+		queue.pop();
+
+		auto fail = failure[state];
+		outputLinks[state] = outputs[fail].empty() ? outputLinks[fail] : fail;
+
+		for (u64 c = 0; c != numClasses; c++) {
+			auto& next = transitions[state * numClasses + c];
+			if (next) {
+				failure[next] = transitions[fail * numClasses + c];
+				queue.push(next);
+			}
+			else {
+				next = transitions[fail * numClasses + c];
+			}
+		}
+	}
+}
+
+template<typename F>
+void PatternMatcher::scan(StringView text, F&& func) const {
+	auto ptr = text.data();
+	auto length = text.byteCount();
+
+	if (usesAutomaton()) {
+		u32 state = 0;
+		for (u64 i = 0; i != length; i++) {
+			state = transitions[state * numClasses + byteClasses[ptr[i]]];
+			for (auto out = outputs[state].empty() ? outputLinks[state] : state; out; out = outputLinks[out]) {
+				for (auto p : outputs[out]) {
+					if (!func(p, i + 1 - patterns[p].size())) {
+						return;
+					}
+				}
+			}
+		}
+		return;
+	}
+
+	auto checkPosition = [&](u64 pos) {
+		auto bucket = std::find(firstBytes.begin(), firstBytes.end(), ptr[pos]) - firstBytes.begin();
+		for (auto p : patternsByFirstByte[bucket]) {
+			auto& pattern = patterns[p];
+			if (pattern.size() <= length - pos && !memcmp(ptr + pos, pattern.data(), pattern.size())) {
+				if (!func(p, pos)) {
+					return false;
+				}
+			}
+		}
+		return true;
+	};
+
+	// Look for the first bytes of all patterns in groups of 16 bytes at once
+	u64 pos = 0;
+	for (; pos + Simd::TGroupSize <= length; pos += Simd::TGroupSize) {
+		u32 candidates = 0;
+		for (auto b : firstBytes) {
+			candidates |= Simd::equalMask(ptr + pos, b);
+		}
+
+		for (; candidates; candidates &= candidates - 1) {
+			if (!checkPosition(pos + Simd::countTrailingZeros(candidates))) {
+				return;
+			}
+		}
+	}
+
+	for (; pos < length; pos++) {
+		if (std::find(firstBytes.begin(), firstBytes.end(), ptr[pos]) != firstBytes.end() && !checkPosition(pos)) {
+			return;
+		}
+	}
+}
+
+std::vector<PatternMatcher::Match> PatternMatcher::findAll(StringView text, bool withCodePointOffsets) const {
+	std::vector<Match> matches;
+	scan(text, [&](u64 pattern, u64 offset) {
+		matches.push_back({ pattern, offset, 0 });
+		return true;
+	});
+
+	std::sort(matches.begin(), matches.end(), [](const Match& a, const Match& b) {
+		return a.byteOffset != b.byteOffset ? a.byteOffset < b.byteOffset : a.pattern < b.pattern;
+	});
+
+	// The matches are ordered, so the code points only need to be counted up to the next one
+	if (withCodePointOffsets) {
+		u64 byteOffset = 0;
+		u64 codePointOffset = 0;
+		for (auto& m : matches) {
+			codePointOffset += Character::countCodePointsInBuffer(text.data() + byteOffset, m.byteOffset - byteOffset);
+			byteOffset = m.byteOffset;
+			m.codePointOffset = codePointOffset;
+		}
+	}
+
+	return matches;
+}
+
+bool PatternMatcher::containsAny(StringView text) const {
+	bool found = false;
+	scan(text, [&](u64, u64) {
+		found = true;
+		return false;
+	});
+	return found;
+}
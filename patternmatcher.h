@@ -0,0 +1,56 @@
+#pragma once
+
+#include <vector>
+
+#include "string.h"
+#include "stringview.h"
+
+// Finds all occurrences of a fixed set of patterns in a single pass over a text. Small
+// sets with few distinct first bytes are searched by looking for the first bytes with
+// SIMD compares and checking each candidate position. Larger sets are compiled into an
+// Aho-Corasick automaton with a dense transition table over byte classes
+class PatternMatcher {
+public:
+	struct Match {
+		u64 pattern;
+		u64 byteOffset;
+		u64 codePointOffset;
+	};
+
+	static constexpr u64 TMaxPrefilterPatterns = 16;
+	static constexpr u64 TMaxPrefilterFirstBytes = 8;
+
+	// Empty patterns never match, but still count for the indices of the other patterns
+	// The pattern bytes are copied
+	PatternMatcher(const std::vector<String>& patterns);
+	PatternMatcher(std::initializer_list<StringView> patterns);
+
+	u64 patternCount() const { return patterns.size(); }
+	bool usesAutomaton() const { return !transitions.empty(); }
+
+	// Returns all (also overlapping) matches ordered by their offset and pattern index. Code
+	// point offsets are only computed if requested, otherwise they are zero
+	std::vector<Match> findAll(StringView text, bool withCodePointOffsets = false) const;
+	bool containsAny(StringView text) const;
+
+private:
+	// Calls the function with the pattern index and byte offset, until it returns false
+	template<typename F>
+	void scan(StringView text, F&& func) const;
+
+	void build();
+
+	std::vector<std::string> patterns;
+
+	// Prefilter: Distinct first bytes and the patterns starting with each of them
+	std::vector<u8> firstBytes;
+	std::vector<std::vector<u32>> patternsByFirstByte;
+
+	// Automaton: State x byte class transitions, the patterns ending in each state and
+	// the next state along the failure links which has patterns ending in it
+	u16 byteClasses[256]{};
+	u64 numClasses{ 0 };
+	std::vector<u32> transitions;
+	std::vector<std::vector<u32>> outputs;
+	std::vector<u32> outputLinks;
+};
@@ -0,0 +1,302 @@
+#pragma once
+
+#include <cassert>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define COW_SIMD_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "util.h"
+
+// Byte wise compare kernels over groups of 16 bytes, which return a bit mask with one
+// bit per byte. SSE2 is used when available, otherwise the mask is built per byte
+namespace Simd {
+	static constexpr u64 TGroupSize = 16;
+
+	// Bit i is set if ptr[i] == byte
+	inline u32 equalMask(const u8* ptr, u8 byte) {
+#if defined(COW_SIMD_SSE2)
+		auto group = _mm_loadu_si128((const __m128i*)ptr);
+		return (u32)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)byte)));
+#else
+		u32 mask = 0;
+		for (u64 i = 0; i != TGroupSize; i++) {
+			mask |= (u32)(ptr[i] == byte) << i;
+		}
+		return mask;
+#endif
+	}
+
+	// Bit i is set if the high bit of ptr[i] is set (ie. it is not ASCII)
+	inline u32 highBitMask(const u8* ptr) {
+#if defined(COW_SIMD_SSE2)
+		return (u32)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)ptr));
+#else
+		u32 mask = 0;
+		for (u64 i = 0; i != TGroupSize; i++) {
+			mask |= (u32)(ptr[i] >> 7) << i;
+		}
+		return mask;
+#endif
+	}
+
+	// Bit i is set if ptr[i] is a UTF-8 continuation byte (80 - BF)
+	inline u32 continuationMask(const u8* ptr) {
+#if defined(COW_SIMD_SSE2)
+		// Continuation bytes are the signed bytes below C0 (-64)
+		auto group = _mm_loadu_si128((const __m128i*)ptr);
+		return (u32)_mm_movemask_epi8(_mm_cmplt_epi8(group, _mm_set1_epi8((char)0xC0)));
+#else
+		u32 mask = 0;
+		for (u64 i = 0; i != TGroupSize; i++) {
+			mask |= (u32)((ptr[i] & 0xC0) == 0x80) << i;
+		}
+		return mask;
+#endif
+	}
+
+	inline u32 countTrailingZeros(u64 x) {
+		assert(x);
+#if defined(_MSC_VER)
+		unsigned long idx;
+		_BitScanForward64(&idx, x);
+		return (u32)idx;
+#else
+		return (u32)__builtin_ctzll(x);
+#endif
+	}
+
+	inline u32 popCount(u64 x) {
+#if defined(_MSC_VER)
+		return (u32)__popcnt64(x);
+#else
+		return (u32)__builtin_popcountll(x);
+#endif
+	}
+
+	// Widens 16 ASCII bytes to UTF-16 or UTF-32 code units
+	inline void widenAscii(const u8* ptr, char16_t* out) {
+#if defined(COW_SIMD_SSE2)
+		auto group = _mm_loadu_si128((const __m128i*)ptr);
+		auto zero = _mm_setzero_si128();
+		_mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi8(group, zero));
+		_mm_storeu_si128((__m128i*)(out + 8), _mm_unpackhi_epi8(group, zero));
+#else
+		for (u64 i = 0; i != TGroupSize; i++) {
+			out[i] = ptr[i];
+		}
+#endif
+	}
+
+	inline void widenAscii(const u8* ptr, char32_t* out) {
+#if defined(COW_SIMD_SSE2)
+		auto group = _mm_loadu_si128((const __m128i*)ptr);
+		auto zero = _mm_setzero_si128();
+		auto low = _mm_unpacklo_epi8(group, zero);
+		auto high = _mm_unpackhi_epi8(group, zero);
+		_mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi16(low, zero));
+		_mm_storeu_si128((__m128i*)(out + 4), _mm_unpackhi_epi16(low, zero));
+		_mm_storeu_si128((__m128i*)(out + 8), _mm_unpacklo_epi16(high, zero));
+		_mm_storeu_si128((__m128i*)(out + 12), _mm_unpackhi_epi16(high, zero));
+#else
+		for (u64 i = 0; i != TGroupSize; i++) {
+			out[i] = ptr[i];
+		}
+#endif
+	}
+
+	// Narrows 16 UTF-16 code units to bytes if they are all ASCII, otherwise nothing is written
+	inline bool narrowAscii(const char16_t* ptr, u8* out) {
+#if defined(COW_SIMD_SSE2)
+		auto low = _mm_loadu_si128((const __m128i*)ptr);
+		auto high = _mm_loadu_si128((const __m128i*)(ptr + 8));
+		auto nonAscii = _mm_and_si128(_mm_or_si128(low, high), _mm_set1_epi16((short)0xFF80));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, _mm_setzero_si128())) != 0xFFFF) {
+			return false;
+		}
+		_mm_storeu_si128((__m128i*)out, _mm_packus_epi16(low, high));
+		return true;
+#else
+		for (u64 i = 0; i != TGroupSize; i++) {
+			if (ptr[i] >= 0x80) {
+				return false;
+			}
+		}
+		for (u64 i = 0; i != TGroupSize; i++) {
+			out[i] = (u8)ptr[i];
+		}
+		return true;
+#endif
+	}
+
+	// Bit i is set if lower <= ptr[i] <= upper, where the bounds have to be either both in
+	// 01 - 7E (ASCII) or both in 81 - FE (UTF-8 lead and continuation bytes)
+	inline u32 rangeMask(const u8* ptr, u8 lower, u8 upper) {
+#if defined(COW_SIMD_SSE2)
+		// The bytes are compared as signed bytes. Bytes >= 0x80 are negative, which are never
+		// in an ASCII range, and keep their order among each other
+		auto group = _mm_loadu_si128((const __m128i*)ptr);
+		auto inRange = _mm_and_si128(_mm_cmpgt_epi8(group, _mm_set1_epi8((char)(lower - 1))), _mm_cmplt_epi8(group, _mm_set1_epi8((char)(upper + 1))));
+		return (u32)_mm_movemask_epi8(inRange);
+#else
+		u32 mask = 0;
+		for (u64 i = 0; i != TGroupSize; i++) {
+			mask |= (u32)(ptr[i] >= lower && ptr[i] <= upper) << i;
+		}
+		return mask;
+#endif
+	}
+
+	// Switches the case of the ASCII letters of 16 bytes, all other bytes are kept
+	inline void asciiToLower(const u8* ptr, u8* out) {
+#if defined(COW_SIMD_SSE2)
+		auto group = _mm_loadu_si128((const __m128i*)ptr);
+		auto isUpper = _mm_and_si128(_mm_cmpgt_epi8(group, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(group, _mm_set1_epi8('Z' + 1)));
+		_mm_storeu_si128((__m128i*)out, _mm_add_epi8(group, _mm_and_si128(isUpper, _mm_set1_epi8(0x20))));
+#else
+		for (u64 i = 0; i != TGroupSize; i++) {
+			out[i] = ptr[i] + ((ptr[i] >= 'A' && ptr[i] <= 'Z') ? 0x20 : 0);
+		}
+#endif
+	}
+
+	inline void asciiToUpper(const u8* ptr, u8* out) {
+#if defined(COW_SIMD_SSE2)
+		auto group = _mm_loadu_si128((const __m128i*)ptr);
+		auto isLower = _mm_and_si128(_mm_cmpgt_epi8(group, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(group, _mm_set1_epi8('z' + 1)));
+		_mm_storeu_si128((__m128i*)out, _mm_sub_epi8(group, _mm_and_si128(isLower, _mm_set1_epi8(0x20))));
+#else
+		for (u64 i = 0; i != TGroupSize; i++) {
+			out[i] = ptr[i] - ((ptr[i] >= 'a' && ptr[i] <= 'z') ? 0x20 : 0);
+		}
+#endif
+	}
+
+	// Writes the 16 lower or upper case hex digits of 8 bytes, the high nibble first
+	inline void bytesToHex(const u8* ptr, u8* out, bool upperCase) {
+		u8 letterOffset = (upperCase ? 'A' : 'a') - '0' - 10;
+#if defined(COW_SIMD_SSE2)
+		auto bytes = _mm_loadl_epi64((const __m128i*)ptr);
+		auto nibbleMask = _mm_set1_epi8(0x0F);
+		auto nibbles = _mm_unpacklo_epi8(_mm_and_si128(_mm_srli_epi16(bytes, 4), nibbleMask), _mm_and_si128(bytes, nibbleMask));
+		auto isLetter = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+		auto digits = _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), _mm_and_si128(isLetter, _mm_set1_epi8((char)letterOffset)));
+		_mm_storeu_si128((__m128i*)out, digits);
+#else
+		for (u64 i = 0; i != TGroupSize; i++) {
+			u8 nibble = (i & 1) ? ptr[i / 2] & 0x0F : ptr[i / 2] >> 4;
+			out[i] = nibble + '0' + (nibble > 9 ? letterOffset : 0);
+		}
+#endif
+	}
+
+	// Reads 16 hex digits of either case into 8 bytes, or returns false if one is not a digit
+	inline bool hexToBytes(const u8* ptr, u8* out) {
+#if defined(COW_SIMD_SSE2)
+		auto group = _mm_loadu_si128((const __m128i*)ptr);
+		auto lower = _mm_or_si128(group, _mm_set1_epi8(0x20));
+		auto isDigit = _mm_and_si128(_mm_cmpgt_epi8(group, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(group, _mm_set1_epi8('9' + 1)));
+		auto isLetter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+		if (_mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) != 0xFFFF) {
+			return false;
+		}
+
+		// Setting the lower case bit keeps the digits unchanged
+		auto values = _mm_sub_epi8(_mm_sub_epi8(lower, _mm_set1_epi8('0')), _mm_and_si128(isLetter, _mm_set1_epi8('a' - '0' - 10)));
+
+		// The high nibble of a byte is the low byte of its 16 bit lane
+		auto high = _mm_and_si128(values, _mm_set1_epi16(0x00FF));
+		auto bytes = _mm_or_si128(_mm_slli_epi16(high, 4), _mm_srli_epi16(values, 8));
+		_mm_storel_epi64((__m128i*)out, _mm_packus_epi16(bytes, bytes));
+		return true;
+#else
+		u8 values[TGroupSize];
+		for (u64 i = 0; i != TGroupSize; i++) {
+			u8 lower = ptr[i] | 0x20;
+			if (ptr[i] >= '0' && ptr[i] <= '9') {
+				values[i] = ptr[i] - '0';
+			}
+			else if (lower >= 'a' && lower <= 'f') {
+				values[i] = lower - 'a' + 10;
+			}
+			else {
+				return false;
+			}
+		}
+		for (u64 i = 0; i != TGroupSize / 2; i++) {
+			out[i] = (u8)((values[2 * i] << 4) | values[2 * i + 1]);
+		}
+		return true;
+#endif
+	}
+
+	// Maps 16 values 0 - 63 to the characters of the base64 alphabet
+	inline void base64Encode(const u8* values, u8* out) {
+#if defined(COW_SIMD_SSE2)
+		// Every range of the alphabet adds another offset to the value
+		auto group = _mm_loadu_si128((const __m128i*)values);
+		auto offsets = _mm_set1_epi8('A');
+		offsets = _mm_add_epi8(offsets, _mm_and_si128(_mm_cmpgt_epi8(group, _mm_set1_epi8(25)), _mm_set1_epi8('a' - 26 - 'A')));
+		offsets = _mm_add_epi8(offsets, _mm_and_si128(_mm_cmpgt_epi8(group, _mm_set1_epi8(51)), _mm_set1_epi8('0' - 52 - ('a' - 26))));
+		offsets = _mm_add_epi8(offsets, _mm_and_si128(_mm_cmpeq_epi8(group, _mm_set1_epi8(62)), _mm_set1_epi8('+' - 62 - ('0' - 52))));
+		offsets = _mm_add_epi8(offsets, _mm_and_si128(_mm_cmpeq_epi8(group, _mm_set1_epi8(63)), _mm_set1_epi8('/' - 63 - ('0' - 52))));
+		_mm_storeu_si128((__m128i*)out, _mm_add_epi8(group, offsets));
+#else
+		static constexpr char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+		for (u64 i = 0; i != TGroupSize; i++) {
+			out[i] = alphabet[values[i]];
+		}
+#endif
+	}
+
+	// Maps 16 characters of the base64 alphabet to their values, or returns false if one
+	// is not part of it (including the '=' padding)
+	inline bool base64Decode(const u8* ptr, u8* values) {
+#if defined(COW_SIMD_SSE2)
+		auto group = _mm_loadu_si128((const __m128i*)ptr);
+		auto isUpper = _mm_and_si128(_mm_cmpgt_epi8(group, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(group, _mm_set1_epi8('Z' + 1)));
+		auto isLower = _mm_and_si128(_mm_cmpgt_epi8(group, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(group, _mm_set1_epi8('z' + 1)));
+		auto isDigit = _mm_and_si128(_mm_cmpgt_epi8(group, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(group, _mm_set1_epi8('9' + 1)));
+		auto isPlus = _mm_cmpeq_epi8(group, _mm_set1_epi8('+'));
+		auto isSlash = _mm_cmpeq_epi8(group, _mm_set1_epi8('/'));
+		auto isValid = _mm_or_si128(_mm_or_si128(_mm_or_si128(isUpper, isLower), _mm_or_si128(isDigit, isPlus)), isSlash);
+		if (_mm_movemask_epi8(isValid) != 0xFFFF) {
+			return false;
+		}
+
+		// The ranges do not overlap, so exactly one offset is selected for every character
+		auto offsets = _mm_and_si128(isUpper, _mm_set1_epi8(-'A'));
+		offsets = _mm_or_si128(offsets, _mm_and_si128(isLower, _mm_set1_epi8(26 - 'a')));
+		offsets = _mm_or_si128(offsets, _mm_and_si128(isDigit, _mm_set1_epi8(52 - '0')));
+		offsets = _mm_or_si128(offsets, _mm_and_si128(isPlus, _mm_set1_epi8(62 - '+')));
+		offsets = _mm_or_si128(offsets, _mm_and_si128(isSlash, _mm_set1_epi8(63 - '/')));
+		_mm_storeu_si128((__m128i*)values, _mm_add_epi8(group, offsets));
+		return true;
+#else
+		for (u64 i = 0; i != TGroupSize; i++) {
+			auto c = ptr[i];
+			if (c >= 'A' && c <= 'Z') {
+				values[i] = c - 'A';
+			}
+			else if (c >= 'a' && c <= 'z') {
+				values[i] = c - 'a' + 26;
+			}
+			else if (c >= '0' && c <= '9') {
+				values[i] = c - '0' + 52;
+			}
+			else if (c == '+' || c == '/') {
+				values[i] = c == '+' ? 62 : 63;
+			}
+			else {
+				return false;
+			}
+		}
+		return true;
+#endif
+	}
+}
@@ -1,5 +1,9 @@
 
+#include <cstring>
+
 #include "string.h"
+#include "stringview.h"
+#include "simd.h"
 
 std::ostream& operator << (std::ostream& o, StringIntrospection::Mode m) {
 	o << StringIntrospection::modeToString(m);
@@ -15,6 +19,10 @@ String::Mode String::mode() const {
 		return Mode::Literal;
 	}
 
+	if (isFileBacked()) {
+		return Mode::File;
+	}
+
 	if (isShared()) {
 		return Mode::Shared;
 	}
@@ -33,6 +41,7 @@ void String::setMode(Mode m) {
 		return;
 	case Mode::Owned:
 	case Mode::Shared:
+	case Mode::File:
 		data.bytes[TSmallCapacity - 1] |= 0x80;
 		return;
 	}
@@ -43,7 +52,7 @@ void String::initAsSmallString(const u8* ptr, u64 len) {
 	assert(len <= TSmallCapacity);
 	memcpy(data.bytes, ptr, len);
 	data.bytes[TSmallCapacity - 1] = (TSmallCapacity - len);
-	data.bytes[len] = '\0';
+	data.bytes[len - 1] = '\0';
 	setMode(Mode::Small);
 }
 
@@ -52,13 +61,25 @@ void String::initAsSmallString() {
 	data.bytes[0] = '\0';
 }
 
+void String::initAsSharedSlice(const SharedPtr<Shared<u8[]>>& buffer, u64 offset, u64 len) {
+	// Reference a null-terminated range of bytes inside of an existing buffer
+	assert(buffer && buffer.dataPtr()[offset + len - 1] == '\0');
+
+	data.dyn.construct();
+	setMode(Mode::Owned); // Becomes shared by referencing the buffer
+	dyn().buffer() = buffer;
+	dyn().offset = offset;
+	dyn().used = len;
+	resetCodePointsLitOrDyn();
+}
+
 void String::initAsLiteralString(const char* s, u64 len) {
 	assert(s);
 
 	data.lit.construct();
 	setMode(Mode::Literal);
 	lit().buffer() = s;
-	lit().capacity = 0;
+	lit().offset = 0;
 	lit().used = len;
 	lit().setCodePoints(0);
 }
@@ -73,7 +94,7 @@ const u8* String::safeBufferPointer() const {
 	}
 
 	if (isDynamic() && dyn().buffer()) {
-		return dyn().buffer().dataPtr();
+		return dynBufferPointer();
 	}
 
 	static char defaultEmptyString[] = "";
@@ -100,39 +121,93 @@ void String::resetCodePointsLitOrDyn() {
 	}
 }
 
+u8* String::initAsUninitialized(u64 numBytes, u64 numCodePoints) {
+	assert(isEmpty() && numBytes);
+	if (numBytes <= TSmallCapacity) {
+		data.bytes[TSmallCapacity - 1] = (u8)(TSmallCapacity - numBytes);
+		data.bytes[numBytes - 1] = '\0';
+		return data.bytes;
+	}
+
+	ensureOwnedCapacity(numBytes);
+	dyn().used = numBytes;
+	dyn().setCodePoints(numCodePoints);
+	dynBufferPointer()[numBytes - 1] = '\0';
+	return dynBufferPointer();
+}
+
+OwnPtr<Shared<u8[]>> String::allocateBuffer(u64 numBytes) {
+	if (numBytes >= THugeCapacity) {
+		return Shared<u8[]>::makeMapped(numBytes);
+	}
+
+	return Shared<u8[]>::makeUninitialized(numBytes);
+}
+
 void String::ensureOwnedCapacity(u64 numBytes) {
 	if (!isDynamic()) {
 		growIntoDynamicString(numBytes);
 		return;
 	}
 
+	// The text is about to be written
+	dyn().forgetNormalization();
+	if (isOwned()) {
+		dropBufferAttachment();
+	}
+
 	// There is still enough space in the owned buffer
 	auto curCapacity = bufferCapacity();
 	auto hasSpace = curCapacity >= numBytes;
-	if (!isShared() && hasSpace) {
+	if (isOwned() && hasSpace) {
 		return;
 	}
 
 	// Make an owned buffer, that will be larger if needed
 	// At least as large as the number of bytes requested and double the small version size
 	// The buffer size doubles by default.
+	// The allocator might hand out a larger block, which is kept as additional capacity
 	auto newCapacity = hasSpace ? curCapacity : std::max({ curCapacity * 2, numBytes, TSmallCapacity * 2 });
-	auto newBuffer = Shared<u8[]>::make(newCapacity);
+
+	// Headroom left by removed prefixes is reclaimed by moving the text to the front. This is only done
+	// if the headroom is at least as large as the text, so that the moving amortizes
+	if (isOwned() && dyn().buffer() && dyn().offset >= dyn().used && dyn().buffer().ptr()->size() >= numBytes) {
+		memmove(dyn().buffer().dataPtr(), dynBufferPointer(), dyn().used);
+		dyn().offset = 0;
+		return;
+	}
+
+	// An owned huge buffer is remapped in place, which neither copies nor needs space for both buffers
+	if (isOwned() && dyn().buffer() && dyn().buffer().ptr()->isMapped()) {
+		// The buffer is handed back if remapping throws, so the string keeps its text
+		auto ownedBuffer = dyn().buffer().tryOwning();
+		try {
+			dyn().buffer() = Shared<u8[]>::growMapped(std::move(ownedBuffer), newCapacity + dyn().offset);
+		}
+		catch (...) {
+			dyn().buffer() = std::move(ownedBuffer);
+			throw;
+		}
+		return;
+	}
+
+	auto newBuffer = allocateBuffer(newCapacity);
 
 	// If there already exists a (possibly shared) buffer, the contents are copied
+	// The new buffer has no headroom, the text starts right at the beginning
 	if (dyn().buffer()) {
-		memcpy(newBuffer.ptr()->value, dyn().buffer().dataPtr(), dyn().used);
+		memcpy(newBuffer.ptr()->value, dynBufferPointer(), dyn().used);
 	}
 
 	dyn().buffer() = std::move(newBuffer);
-	dyn().capacity = newCapacity;
+	dyn().offset = 0;
 }
 
 void String::growIntoDynamicString(u64 numBytes) {
 	assert(isSmall() || isLiteral());
 	// Allocate dyn memory and store the characters there
 	auto newCapacity = std::max(TSmallCapacity * 2, numBytes);
-	auto newBuffer = Shared<u8[]>::make(newCapacity);
+	auto newBuffer = allocateBuffer(newCapacity);
 	auto ptr = newBuffer.ptr()->value;
 	u64 used = bufferSize();
 	memcpy(ptr, safeBufferPointer(), used);
@@ -141,7 +216,7 @@ void String::growIntoDynamicString(u64 numBytes) {
 	data.dyn.construct();
 	setMode(Mode::Owned); // Construct zero initializes all PODs
 	dyn().buffer() = std::move(newBuffer);
-	dyn().capacity = newCapacity;
+	dyn().offset = 0;
 	dyn().used = used;
 	resetCodePointsLitOrDyn();
 }
@@ -159,17 +234,17 @@ void String::appendBytes(const u8* bytes, u64 numBytes) {
 		return;
 	}
 
-	auto oldDataPtr = isDynamic() ? dyn().buffer().dataPtr() : nullptr;
+	auto oldDataPtr = isDynamic() ? dynBufferPointer() : nullptr;
 
 	ensureOwnedCapacity(used + numBytes);
 
 	// If the string is append to itself, reallocation on buffer expansion would make the following a use after free
 	if (bytes == oldDataPtr) {
-		bytes = dyn().buffer().dataPtr();
+		bytes = dynBufferPointer();
 	}
 
-	memcpy(dyn().buffer().dataPtr() + used - 1, bytes, numBytes);
-	dyn().buffer()[used + numBytes - 1] = '\0';
+	memcpy(dynBufferPointer() + used - 1, bytes, numBytes);
+	dynBufferPointer()[used + numBytes - 1] = '\0';
 	dyn().used = used + numBytes;
 
 	// If the number of appended bytes is not too long, just count them
@@ -182,6 +257,57 @@ void String::appendBytes(const u8* bytes, u64 numBytes) {
 	}
 }
 
+void String::prependBytes(const u8* bytes, u64 numBytes) {
+	// Prepend non-null terminated bytes
+	auto used = bufferSize();
+
+	// There is still enough space in the small string (the string obj itself)
+	if (isSmall() && (used + numBytes <= TSmallCapacity)) {
+		memmove(data.bytes + numBytes, data.bytes, used);
+		memmove(data.bytes, bytes, numBytes);
+		data.bytes[TSmallCapacity - 1] = (TSmallCapacity - used - numBytes);
+		data.bytes[used + numBytes - 1] = '\0';
+		return;
+	}
+
+	bool wasDynamic = isDynamic();
+
+	// An owned buffer with enough headroom gets the bytes written right in front of the text
+	if (wasDynamic && isOwned() && dyn().buffer() && dyn().offset >= numBytes) {
+		dropBufferAttachment();
+		dyn().offset -= numBytes;
+		memcpy(dynBufferPointer(), bytes, numBytes);
+		dyn().used = used + numBytes;
+	}
+	else {
+		// Make a new buffer with as much headroom as the resulting text is long, so
+		// that prepending repeatedly needs a logarithmic number of allocations
+		auto headroom = std::max(used + numBytes, TSmallCapacity);
+		auto newBuffer = allocateBuffer(headroom + used + numBytes);
+		auto ptr = newBuffer.ptr()->value + headroom;
+		memcpy(ptr, bytes, numBytes);
+		memcpy(ptr + numBytes, safeBufferPointer(), used);
+
+		if (!wasDynamic) {
+			data.dyn.construct();
+			setMode(Mode::Owned);
+		}
+
+		dyn().buffer() = std::move(newBuffer);
+		dyn().offset = headroom;
+		dyn().used = used + numBytes;
+	}
+
+	// If the number of prepended bytes is not too long, just count them
+	if (wasDynamic && dyn().hasCachedCodePoints() && numBytes <= 64) {
+		auto numPoints = Character::countCodePointsInBuffer(dynBufferPointer(), numBytes);
+		dyn().setCodePoints(dyn().getCodePoints() + numPoints);
+	}
+	else {
+		resetCodePointsLitOrDyn();
+	}
+}
+
 String::String(const String& s) {
 
 	// Copy the content of the small string
@@ -208,20 +334,36 @@ String::String(String&& s) {
 	}
 
 	if (s.isLiteral()) {
-		data.lit.value() = data.lit.value();
+		data.lit.value() = s.data.lit.value();
 		return;
 	}
 
 	// Gut the buffer from the moved string
 	data.dyn.construct();
 	setMode(Mode::Owned); // Could also be shared (construct zero initialized all PODs)
-	dyn().capacity = s.dyn().capacity;
+	dyn().offset = s.dyn().offset;
 	dyn().used = s.dyn().used;
 	dyn().setCodePoints(s.dyn().getCodePoints());
 	dyn().buffer() = std::move(s.dyn().buffer());
 	s.initAsSmallString();
 }
 
+String& String::operator=(const String& s) {
+	if (this != &s) {
+		this->~String();
+		new(this) String(s);
+	}
+	return *this;
+}
+
+String& String::operator=(String&& s) {
+	if (this != &s) {
+		this->~String();
+		new(this) String(std::move(s));
+	}
+	return *this;
+}
+
 String::String(const char* s, std::optional<u64> knownLen) {
 	auto l = knownLen ? *knownLen : strlen(s) + 1;
 	if (l <= TSmallCapacity) {
@@ -232,11 +374,35 @@ String::String(const char* s, std::optional<u64> knownLen) {
 	data.dyn.construct();
 	setMode(Mode::Owned); // After zero init all PODs
 	ensureOwnedCapacity(l);
-	memcpy(dyn().buffer().dataPtr(), s, l);
+	memcpy(dynBufferPointer(), s, l);
 	dyn().used = l;
 	resetCodePointsLitOrDyn();
 }
 
+std::optional<String> String::fromFile(const char* path) {
+	auto buffer = Shared<u8[]>::makeFromFile(path);
+	if (!buffer) {
+		return {};
+	}
+
+	// Short files are copied into a small string and the mapping is dropped right away
+	auto used = buffer->size();
+	if (used <= TSmallCapacity) {
+		String s;
+		s.initAsSmallString(buffer.ptr()->value, used);
+		return s;
+	}
+
+	String s;
+	s.data.dyn.construct();
+	s.setMode(Mode::File);
+	s.dyn().buffer() = std::move(buffer);
+	s.dyn().offset = 0;
+	s.dyn().used = used;
+	s.resetCodePointsLitOrDyn();
+	return s;
+}
+
 String::~String() {
 	if (isDynamic()) {
 		// data.dyn.destroy();
@@ -253,7 +419,8 @@ u64 String::bufferCapacity() const {
 		return 0;
 	}
 
-	return dyn().buffer() ? dyn().capacity : 0;
+	// Headroom in front of the text can only be used by prepending
+	return dyn().buffer() ? dyn().buffer().ptr()->size() - dyn().offset : 0;
 }
 
 u64 String::bufferSize() const {
@@ -268,6 +435,623 @@ u64 String::bufferSize() const {
 	return dyn().buffer() ? dyn().used : 0;
 }
 
+// Returns the offset of the first character whose case changes, or the length if there is none
+static u64 findCaseChange(const u8* ptr, u64 length, bool upper) {
+	u64 i = 0;
+	while (i < length) {
+		// Skip groups without letters of the other case and non ASCII bytes
+		if (length - i >= Simd::TGroupSize) {
+			auto mask = Simd::highBitMask(ptr + i) | (upper ? Simd::rangeMask(ptr + i, 'a', 'z') : Simd::rangeMask(ptr + i, 'A', 'Z'));
+			if (!mask) {
+				i += Simd::TGroupSize;
+				continue;
+			}
+			i += Simd::countTrailingZeros(mask);
+		}
+
+		auto len = Character::byteLengthFromLeadingByte(ptr[i]);
+		if (i + len > length) {
+			break;
+		}
+
+		auto codePoint = Character(ptr + i).toUnicodeCodepoint();
+		if ((upper ? Character::toUpperCodePoint(codePoint) : Character::toLowerCodePoint(codePoint)) != codePoint) {
+			return i;
+		}
+		i += len;
+	}
+	return length;
+}
+
+static void convertCase(u8* ptr, u64 length, bool upper) {
+	u64 i = 0;
+	while (i < length) {
+		if (length - i >= Simd::TGroupSize && !Simd::highBitMask(ptr + i)) {
+			upper ? Simd::asciiToUpper(ptr + i, ptr + i) : Simd::asciiToLower(ptr + i, ptr + i);
+			i += Simd::TGroupSize;
+			continue;
+		}
+
+		auto len = Character::byteLengthFromLeadingByte(ptr[i]);
+		if (i + len > length) {
+			break;
+		}
+
+		auto codePoint = Character(ptr + i).toUnicodeCodepoint();
+		auto mapped = upper ? Character::toUpperCodePoint(codePoint) : Character::toLowerCodePoint(codePoint);
+		if (mapped != codePoint) {
+			// The mappings keep the byte length, so the text can be changed in place. Invalid
+			// sequences that decode to some letter are left alone
+			auto c = Character::fromCodePoint(mapped);
+			if (c.byteCount() == len) {
+				memcpy(ptr + i, c.bytes(), len);
+			}
+		}
+		i += len;
+	}
+}
+
+void String::changeCase(bool upper) {
+	if (isEmpty()) {
+		return;
+	}
+
+	auto length = bufferSize() - 1;
+	auto first = findCaseChange(safeBufferPointer(), length, upper);
+	if (first == length) {
+		return;
+	}
+
+	// Copies shared, literal and file backed text into an owned buffer
+	if (!isSmall()) {
+		ensureOwnedCapacity(bufferSize());
+	}
+
+	auto ptr = isSmall() ? data.bytes : dynBufferPointer();
+	convertCase(ptr + first, length - first, upper);
+}
+
+String& String::toLower() {
+	changeCase(false);
+	return *this;
+}
+
+String& String::toUpper() {
+	changeCase(true);
+	return *this;
+}
+
+bool String::equalsIgnoreCase(const String& s) const {
+	// Case folding keeps the byte length
+	if (isEmpty() || s.isEmpty()) {
+		return isEmpty() == s.isEmpty();
+	}
+
+	auto length = bufferSize() - 1;
+	if (length + 1 != s.bufferSize()) {
+		return false;
+	}
+
+	auto ptr = safeBufferPointer();
+	auto otherPtr = s.safeBufferPointer();
+	u64 i = 0;
+	while (i < length) {
+		if (length - i >= Simd::TGroupSize && !(Simd::highBitMask(ptr + i) | Simd::highBitMask(otherPtr + i))) {
+			u8 lower[Simd::TGroupSize], otherLower[Simd::TGroupSize];
+			Simd::asciiToLower(ptr + i, lower);
+			Simd::asciiToLower(otherPtr + i, otherLower);
+			if (memcmp(lower, otherLower, Simd::TGroupSize)) {
+				return false;
+			}
+			i += Simd::TGroupSize;
+			continue;
+		}
+
+		auto len = Character::byteLengthFromLeadingByte(ptr[i]);
+		if (len != Character::byteLengthFromLeadingByte(otherPtr[i]) || i + len > length) {
+			return !memcmp(ptr + i, otherPtr + i, length - i);
+		}
+
+		if (Character::foldCodePoint(Character(ptr + i).toUnicodeCodepoint()) != Character::foldCodePoint(Character(otherPtr + i).toUnicodeCodepoint())) {
+			return false;
+		}
+		i += len;
+	}
+	return true;
+}
+
+u64 String::hashIgnoreCase() const {
+	// The folded text is hashed chunk by chunk from a buffer on the stack. Strings that are
+	// equal ignoring case have the same characters lengths, so they are cut into the same chunks
+	u8 chunk[256];
+	u64 chunkUsed = 0;
+	u64 hash = 0;
+
+	auto ptr = safeBufferPointer();
+	auto length = isEmpty() ? 0 : bufferSize() - 1;
+	u64 i = 0;
+	while (i < length) {
+		if (chunkUsed + Simd::TGroupSize > sizeof(chunk)) {
+			hash = Hash::ofBuffer(chunk, chunkUsed, hash);
+			chunkUsed = 0;
+		}
+
+		if (length - i >= Simd::TGroupSize && !Simd::highBitMask(ptr + i)) {
+			Simd::asciiToLower(ptr + i, chunk + chunkUsed);
+			chunkUsed += Simd::TGroupSize;
+			i += Simd::TGroupSize;
+			continue;
+		}
+
+		auto len = Character::byteLengthFromLeadingByte(ptr[i]);
+		if (i + len > length) {
+			memcpy(chunk + chunkUsed, ptr + i, length - i);
+			chunkUsed += length - i;
+			break;
+		}
+
+		auto codePoint = Character(ptr + i).toUnicodeCodepoint();
+		auto c = Character::fromCodePoint(Character::foldCodePoint(codePoint));
+		memcpy(chunk + chunkUsed, c.byteCount() == len ? c.bytes() : ptr + i, len);
+		chunkUsed += len;
+		i += len;
+	}
+
+	return Hash::ofBuffer(chunk, chunkUsed, hash);
+}
+
+// Decodes the character at the offset and returns its byte length. Returns 0 if the bytes
+// there are not a complete and valid character, which normalizing leaves as they are
+static u64 decodeCodePointAt(const u8* ptr, u64 idx, u64 length, u32* codePoint) {
+	auto len = Character::byteLengthFromLeadingByte(ptr[idx]);
+	if ((ptr[idx] & 0xC0) == 0x80 || ptr[idx] >= 0xF8 || len > length - idx) {
+		return 0;
+	}
+	for (u64 i = 1; i < len; i++) {
+		if ((ptr[idx + i] & 0xC0) != 0x80) {
+			return 0;
+		}
+	}
+
+	// Overlong encodings, surrogates and code points beyond U+10FFFF are broken as well
+	static constexpr u32 minCodePoints[5] = { 0, 0, 0x80, 0x800, 0x10000 };
+	auto c = Character(ptr + idx).toUnicodeCodepoint();
+	if (c < minCodePoints[len] || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) {
+		return 0;
+	}
+	*codePoint = c;
+	return len;
+}
+
+static u8* writeCodePoint(u8* out, u32 codePoint) {
+	auto c = Character::fromCodePoint(codePoint);
+	memcpy(out, c.bytes(), c.byteCount());
+	return out + c.byteCount();
+}
+
+static bool isCheckedLeadByte(u8 byte, u8 firstLeadByte) {
+	return (byte >= firstLeadByte && byte <= 0xE3) || byte >= 0xEA;
+}
+
+// Quick check of UAX #15 over the text: Its characters have to be allowed in the form and
+// every run of combining marks has to be ordered by their classes
+static Character::QuickCheck isNormalizedText(const u8* ptr, u64 length, bool composed) {
+	// Characters below U+0300 may all stay in composed text, and below U+00C0 none of them
+	// decomposes. The ideographs U+4000 - U+9FFF (E4 - E9) stay in both forms. So only the
+	// lead bytes of the other characters are looked at, all skipped ones are starters
+	u8 firstLeadByte = composed ? 0xCC : 0xC3;
+	auto result = Character::QuickCheck::Yes;
+	u8 lastClass = 0;
+	u64 i = 0;
+	while (i < length) {
+		if (length - i >= Simd::TGroupSize) {
+			auto mask = Simd::rangeMask(ptr + i, firstLeadByte, 0xE3) | Simd::rangeMask(ptr + i, 0xEA, 0xFE);
+			if (!mask) {
+				lastClass = 0;
+				i += Simd::TGroupSize;
+				continue;
+			}
+			if (Simd::countTrailingZeros(mask)) {
+				lastClass = 0;
+				i += Simd::countTrailingZeros(mask);
+			}
+		}
+		else if (!isCheckedLeadByte(ptr[i], firstLeadByte)) {
+			lastClass = 0;
+			i++;
+			continue;
+		}
+
+		u32 codePoint;
+		auto len = decodeCodePointAt(ptr, i, length, &codePoint);
+		if (!len) {
+			lastClass = 0;
+			i++;
+			continue;
+		}
+
+		u8 markClass;
+		auto check = Character::quickCheckCodePoint(codePoint, composed, &markClass);
+		if (check == Character::QuickCheck::No || (markClass && lastClass > markClass)) {
+			return Character::QuickCheck::No;
+		}
+		if (check == Character::QuickCheck::Maybe) {
+			result = Character::QuickCheck::Maybe;
+		}
+
+		lastClass = markClass;
+		i += len;
+	}
+	return result;
+}
+
+// Composes the decomposed text in place and returns its new length. Every composition
+// removes a code point. A character composes with the last starter, unless a character
+// in between has the class 0 or at least the class of the character (it is blocked)
+static u64 composeText(u8* ptr, u64 length, u64* numCodePoints) {
+	u64 written = 0;
+	u64 starterIdx = 0;
+	u64 starterEnd = 0;
+	u32 starter = 0;
+	bool hasStarter = false;
+	u8 lastClass = 0;
+
+	u64 i = 0;
+	while (i < length) {
+		// ASCII characters are starters that never compose with the one in front of them
+		if (ptr[i] < 0x80) {
+			starterIdx = written;
+			starterEnd = written + 1;
+			starter = ptr[i];
+			hasStarter = true;
+			lastClass = 0;
+			ptr[written++] = ptr[i++];
+			continue;
+		}
+
+		u32 codePoint;
+		auto len = decodeCodePointAt(ptr, i, length, &codePoint);
+		if (!len) {
+			// Nothing composes across broken bytes
+			hasStarter = false;
+			ptr[written++] = ptr[i++];
+			continue;
+		}
+
+		auto markClass = Character::combiningClass(codePoint);
+		if (hasStarter && (written == starterEnd || lastClass < markClass)) {
+			if (auto composed = Character::composeCodePoints(starter, codePoint)) {
+				// A composite is never longer than its two parts, so the characters behind the
+				// starter stay in front of the consumed one when they are moved
+				auto c = Character::fromCodePoint(composed);
+				auto newEnd = starterIdx + c.byteCount();
+				memmove(ptr + newEnd, ptr + starterEnd, written - starterEnd);
+				memcpy(ptr + starterIdx, c.bytes(), c.byteCount());
+				written = written - starterEnd + newEnd;
+				starterEnd = newEnd;
+				starter = composed;
+				(*numCodePoints)--;
+				i += len;
+				continue;
+			}
+		}
+
+		if (!markClass) {
+			starterIdx = written;
+			starterEnd = written + len;
+			starter = codePoint;
+			hasStarter = true;
+		}
+		lastClass = markClass;
+
+		memmove(ptr + written, ptr + i, len);
+		written += len;
+		i += len;
+	}
+	return written;
+}
+
+const String::StringDataInterface* String::normalizationCache() const {
+	// Small strings have no room to remember it, but are quickly checked anyway
+	return isLiteral() ? (const StringDataInterface*)&lit() : isDynamic() ? &dyn() : nullptr;
+}
+
+String String::normalized(u64 form) const {
+	// The decomposed text is counted first, as composing can only make it shorter
+	auto ptr = safeBufferPointer();
+	auto length = bufferSize() - 1;
+	u32 parts[Character::TMaxDecomposition];
+	u64 numBytes = 0;
+	u64 numCodePoints = 0;
+	bool isValid = true;
+	u64 i = 0;
+	while (i < length) {
+		if (length - i >= Simd::TGroupSize && !Simd::highBitMask(ptr + i)) {
+			numBytes += Simd::TGroupSize;
+			numCodePoints += Simd::TGroupSize;
+			i += Simd::TGroupSize;
+			continue;
+		}
+
+		u32 codePoint;
+		auto len = decodeCodePointAt(ptr, i, length, &codePoint);
+		if (!len) {
+			isValid = false;
+			numBytes++;
+			i++;
+			continue;
+		}
+
+		auto numParts = Character::decomposeCodePoint(codePoint, parts);
+		for (u64 j = 0; j != numParts; j++) {
+			numBytes += Character::fromCodePoint(parts[j]).byteCount();
+		}
+		numBytes += numParts ? 0 : len;
+		numCodePoints += numParts ? numParts : 1;
+		i += len;
+	}
+
+	// Decompose into the new buffer. The marks following a starter are collected and put
+	// in order of their classes, while marks of the same class keep their order
+	String result;
+	auto out = result.initAsUninitialized(numBytes + 1, isValid ? numCodePoints : 0);
+	auto outPtr = out;
+	std::vector<std::pair<u8, u32>> marks;
+	auto writeMarks = [&]() {
+		std::stable_sort(marks.begin(), marks.end(), [](auto& a, auto& b) { return a.first < b.first; });
+		for (auto& mark : marks) {
+			outPtr = writeCodePoint(outPtr, mark.second);
+		}
+		marks.clear();
+	};
+
+	i = 0;
+	while (i < length) {
+		if (length - i >= Simd::TGroupSize && !Simd::highBitMask(ptr + i)) {
+			writeMarks();
+			memcpy(outPtr, ptr + i, Simd::TGroupSize);
+			outPtr += Simd::TGroupSize;
+			i += Simd::TGroupSize;
+			continue;
+		}
+
+		u32 codePoint;
+		auto len = decodeCodePointAt(ptr, i, length, &codePoint);
+		if (!len) {
+			writeMarks();
+			*outPtr++ = ptr[i++];
+			continue;
+		}
+
+		auto numParts = Character::decomposeCodePoint(codePoint, parts);
+		if (!numParts) {
+			parts[0] = codePoint;
+			numParts = 1;
+		}
+		for (u64 j = 0; j != numParts; j++) {
+			if (auto markClass = Character::combiningClass(parts[j])) {
+				marks.emplace_back(markClass, parts[j]);
+				continue;
+			}
+			writeMarks();
+			outPtr = writeCodePoint(outPtr, parts[j]);
+		}
+		i += len;
+	}
+	writeMarks();
+	assert((u64)(outPtr - out) == numBytes);
+
+	if (form == StringDataInterface::TKnownNFC) {
+		numBytes = composeText(out, numBytes, &numCodePoints);
+	}
+
+	out[numBytes] = '\0';
+	if (result.isSmall()) {
+		result.data.bytes[TSmallCapacity - 1] = (u8)(TSmallCapacity - numBytes - 1);
+	}
+	else {
+		result.dyn().used = numBytes + 1;
+		result.dyn().setCodePoints(isValid ? numCodePoints : 0);
+		result.dyn().setKnownNormalized(form);
+	}
+	return result;
+}
+
+bool String::checkNormalized(u64 form) const {
+	auto cache = normalizationCache();
+	if ((cache && cache->isKnownNormalized(form)) || isEmpty()) {
+		return true;
+	}
+
+	// Text that might not be normalized is compared to its normalized form
+	auto check = isNormalizedText(safeBufferPointer(), bufferSize() - 1, form == StringDataInterface::TKnownNFC);
+	auto isNormalized = check == Character::QuickCheck::Yes || (check == Character::QuickCheck::Maybe && normalized(form) == *this);
+	if (isNormalized && cache) {
+		cache->setKnownNormalized(form);
+	}
+	return isNormalized;
+}
+
+void String::normalize(u64 form) {
+	auto cache = normalizationCache();
+	if ((cache && cache->isKnownNormalized(form)) || isEmpty()) {
+		return;
+	}
+
+	auto check = isNormalizedText(safeBufferPointer(), bufferSize() - 1, form == StringDataInterface::TKnownNFC);
+	if (check != Character::QuickCheck::Yes) {
+		// Text that already was normalized keeps its buffer
+		auto result = normalized(form);
+		if (result != *this) {
+			*this = std::move(result);
+			return;
+		}
+	}
+
+	if (cache) {
+		cache->setKnownNormalized(form);
+	}
+}
+
+String& String::toNFC() {
+	normalize(StringDataInterface::TKnownNFC);
+	return *this;
+}
+
+String& String::toNFD() {
+	normalize(StringDataInterface::TKnownNFD);
+	return *this;
+}
+
+bool String::isNFC() const {
+	return checkNormalized(StringDataInterface::TKnownNFC);
+}
+
+bool String::isNFD() const {
+	return checkNormalized(StringDataInterface::TKnownNFD);
+}
+
+namespace {
+	// Line starts in the range [begin, end) of a buffer as offsets into the buffer. All the
+	// strings sharing the buffer use it, and it grows to cover the ranges they ask for
+	class LineIndex : public SharedAttachment {
+	public:
+		u64 begin{ 0 };
+		u64 end{ 0 };
+		std::vector<u64> lineStarts;
+	};
+}
+
+// Appends the offsets behind the '\n's in the bytes, which start at offset 'base' of the
+// buffer. Returns the number of code points, as the text is read anyway. They are counted
+// like Character::countCodePointsInBuffer does, so that broken sequences count the same
+static u64 findLineStarts(const u8* ptr, u64 length, u64 base, std::vector<u64>& lineStarts) {
+	u64 numCodePoints = 0;
+	u64 numSkipped = 0;
+	auto countCodePoint = [&](u8 byte) {
+		if (numSkipped) {
+			numSkipped--;
+			return;
+		}
+		numCodePoints++;
+		numSkipped = Character::byteLengthFromLeadingByte(byte) - 1;
+	};
+
+	u64 i = 0;
+	for (; length - i >= Simd::TGroupSize; i += Simd::TGroupSize) {
+		if (!numSkipped && !Simd::highBitMask(ptr + i)) {
+			numCodePoints += Simd::TGroupSize;
+		}
+		else {
+			for (u64 j = 0; j != Simd::TGroupSize; j++) {
+				countCodePoint(ptr[i + j]);
+			}
+		}
+
+		for (auto mask = Simd::equalMask(ptr + i, '\n'); mask; mask &= mask - 1) {
+			lineStarts.push_back(base + i + Simd::countTrailingZeros(mask) + 1);
+		}
+	}
+
+	for (; i < length; i++) {
+		countCodePoint(ptr[i]);
+		if (ptr[i] == '\n') {
+			lineStarts.push_back(base + i + 1);
+		}
+	}
+	return numCodePoints;
+}
+
+String::LineStarts String::lineStarts(std::vector<u64>& scratch) const {
+	auto ptr = safeBufferPointer();
+	auto length = isEmpty() ? 0 : bufferSize() - 1;
+	if (!isDynamic() || !dyn().buffer()) {
+		scratch.clear();
+		findLineStarts(ptr, length, 0, scratch);
+		return { scratch.data(), scratch.data() + scratch.size(), 0 };
+	}
+
+	auto buffer = dyn().buffer().ptr();
+	auto data = buffer->value;
+	auto begin = dyn().offset;
+	auto end = begin + length;
+	auto index = dynamic_cast<LineIndex*>(buffer->attachment());
+	if (!index) {
+		OwnPtr<LineIndex> newIndex(new LineIndex());
+		newIndex->begin = begin;
+		newIndex->end = end;
+
+		// The code point count is filled in on the way, if it is not cached yet
+		auto numCodePoints = findLineStarts(ptr, length, begin, newIndex->lineStarts);
+		if (!dyn().hasCachedCodePoints()) {
+			dyn().cacheCodePoints(numCodePoints);
+		}
+
+		index = newIndex.ptr();
+		buffer->attach(OwnPtr<SharedAttachment>(newIndex.release()));
+	}
+
+	// Only the bytes the index does not cover yet are scanned. The bytes between the ranges
+	// of the strings belong to other strings sharing the buffer
+	if (begin < index->begin) {
+		std::vector<u64> front;
+		findLineStarts(data + begin, index->begin - begin, begin, front);
+		index->lineStarts.insert(index->lineStarts.begin(), front.begin(), front.end());
+		index->begin = begin;
+	}
+	if (end > index->end) {
+		findLineStarts(data + index->end, end - index->end, index->end, index->lineStarts);
+		index->end = end;
+	}
+
+	// A '\n' right in front of the text does not start one of its lines
+	auto& starts = index->lineStarts;
+	auto first = std::upper_bound(starts.begin(), starts.end(), begin);
+	auto last = std::upper_bound(first, starts.end(), end);
+	return { starts.data() + (first - starts.begin()), starts.data() + (last - starts.begin()), begin };
+}
+
+u64 String::lineCount() const {
+	std::vector<u64> scratch;
+	return lineStarts(scratch).count();
+}
+
+StringView String::lineAt(u64 idx) const {
+	std::vector<u64> scratch;
+	auto starts = lineStarts(scratch);
+	assert(idx < starts.count());
+
+	// Every line but the last one ends in front of its '\n'
+	auto begin = starts.at(idx);
+	auto end = idx + 1 < starts.count() ? starts.at(idx + 1) - 1 : (isEmpty() ? 0 : bufferSize() - 1);
+	return StringView(cString() + begin, end - begin);
+}
+
+u64 String::lineOfByte(u64 offset) const {
+	std::vector<u64> scratch;
+	auto starts = lineStarts(scratch);
+	return (u64)(std::upper_bound(starts.first, starts.last, starts.base + offset) - starts.first);
+}
+
+bool String::operator==(const String& s) const {
+	// Small strings are compared right inside of their representation, where the last
+	// byte holds their size
+	if (isSmall() && s.isSmall()) {
+		return data.bytes[TSmallCapacity - 1] == s.data.bytes[TSmallCapacity - 1] &&
+			!memcmp(data.bytes, s.data.bytes, bufferSize() - 1);
+	}
+
+	if (isEmpty() || s.isEmpty()) {
+		return isEmpty() == s.isEmpty();
+	}
+
+	// Literals of the same text and slices of the same buffer do not need to be compared
+	auto size = bufferSize();
+	auto ptr = safeBufferPointer();
+	auto otherPtr = s.safeBufferPointer();
+	return size == s.bufferSize() && (ptr == otherPtr || !memcmp(ptr, otherPtr, size - 1));
+}
+
 u64 String::length() const {
 	if (isSmall()) {
 		return countCodePoints();
@@ -275,7 +1059,7 @@ u64 String::length() const {
 
 	if (isLiteral()) {
 		if (!lit().hasCachedCodePoints()) {
-			lit().setCodePoints(countCodePoints());
+			lit().cacheCodePoints(countCodePoints());
 		}
 
 		return lit().getCodePoints();
@@ -288,12 +1072,40 @@ u64 String::length() const {
 	// If more than a '\0' is stored in the buffer and codePoints == 0
 	// -> count the number of code points and store them
 	if (!dyn().hasCachedCodePoints()) {
-		dyn().setCodePoints(countCodePoints());
+		dyn().cacheCodePoints(countCodePoints());
 	}
 
 	return dyn().getCodePoints();
 }
 
+String& String::append(Character c) {
+	// If there is space all four bytes of the character are stored at once, and the extra
+	// ones are overwritten by the null byte or stay in the unused capacity
+	auto numBytes = c.byteCount();
+	auto used = bufferSize();
+	if (isSmall() && used + std::max<u64>(numBytes, 3) <= TSmallCapacity) {
+		memcpy(data.bytes + used - 1, c.bytes(), 4);
+		data.bytes[TSmallCapacity - 1] = (u8)(TSmallCapacity - used - numBytes);
+		data.bytes[used + numBytes - 1] = '\0';
+		return *this;
+	}
+
+	if (isOwned() && used + std::max<u64>(numBytes, 3) <= bufferCapacity()) {
+		dyn().forgetNormalization();
+		dropBufferAttachment();
+		memcpy(dynBufferPointer() + used - 1, c.bytes(), 4);
+		dynBufferPointer()[used + numBytes - 1] = '\0';
+		dyn().used = used + numBytes;
+		if (dyn().hasCachedCodePoints()) {
+			dyn().setCodePoints(dyn().getCodePoints() + 1);
+		}
+		return *this;
+	}
+
+	appendBytes(c.bytes(), numBytes);
+	return *this;
+}
+
 String& String::append(const String& s) {
 	u64 newCodePoints = 0;
 	// Either one is small and the other one is large and has a cached codePoint count
@@ -327,9 +1139,10 @@ String& String::append(String&& s) {
 			((mode() == Mode::Owned) && (bufferCapacity() < s.bufferSize() + bufferSize() - 1)) ||
 			((mode() == Mode::Owned) && (s.bufferCapacity() - bufferCapacity() > bufferSize()))) {
 			// Move the data inside s back and insert this strings data
+			s.dropBufferAttachment();
 			if (!isEmpty()) {
-				memmove(s.dyn().buffer().dataPtr() + bufferSize() - 1, s.dyn().buffer().dataPtr(), s.bufferSize());
-				memcpy(s.dyn().buffer().dataPtr(), safeBufferPointer(), bufferSize() - 1);
+				memmove(s.dynBufferPointer() + bufferSize() - 1, s.dynBufferPointer(), s.bufferSize());
+				memcpy(s.dynBufferPointer(), safeBufferPointer(), bufferSize() - 1);
 			}
 
 			u64 newCodePoints = 0;
@@ -346,7 +1159,7 @@ String& String::append(String&& s) {
 			}
 
 			// Gut the buffer and own it (<- the buffer that is)
-			dyn().capacity = s.dyn().capacity;
+			dyn().offset = s.dyn().offset;
 			dyn().used = oldUsage + s.dyn().used - 1;
 			dyn().setCodePoints(newCodePoints);
 			dyn().buffer() = std::move(s.dyn().buffer());
@@ -380,6 +1193,156 @@ String& String::append(const char* s) {
 	return *this;
 }
 
+// Writes the text with the bytes selected by the mask escaped. Clean runs between them are
+// copied as a whole. Without an output only the size of the escaped text is computed
+template<typename FMask, typename FEscape>
+static u64 escapeText(const u8* ptr, u64 length, u8* out, FMask&& needsEscape, FEscape&& escape) {
+	u64 written = 0;
+	u64 runBegin = 0;
+	auto copyRun = [&](u64 runEnd) {
+		if (out) {
+			memcpy(out + written, ptr + runBegin, runEnd - runBegin);
+		}
+		written += runEnd - runBegin;
+	};
+
+	for (u64 i = 0; i < length; i += Simd::TGroupSize) {
+		u32 mask;
+		if (length - i >= Simd::TGroupSize) {
+			mask = needsEscape(ptr + i);
+		}
+		else {
+			// The last group is padded, and the padding is masked away
+			u8 group[Simd::TGroupSize] = {};
+			memcpy(group, ptr + i, length - i);
+			mask = needsEscape(group) & ((1u << (length - i)) - 1);
+		}
+
+		while (mask) {
+			auto idx = i + Simd::countTrailingZeros(mask);
+			copyRun(idx);
+			written += escape(ptr[idx], out ? out + written : nullptr);
+			runBegin = idx + 1;
+			mask &= mask - 1;
+		}
+	}
+
+	copyRun(length);
+	return written;
+}
+
+static u32 jsonEscapeMask(const u8* ptr) {
+	return Simd::equalMask(ptr, '"') | Simd::equalMask(ptr, '\\') | Simd::equalMask(ptr, 0) | Simd::rangeMask(ptr, 0x01, 0x1F);
+}
+
+static u64 escapeJsonByte(u8 c, u8* out) {
+	static constexpr char hexDigits[] = "0123456789abcdef";
+	char escaped[6] = { '\\', (char)c, '0', '0' };
+	u64 len = 2;
+	switch (c) {
+	case '"': case '\\': break;
+	case '\b': escaped[1] = 'b'; break;
+	case '\f': escaped[1] = 'f'; break;
+	case '\n': escaped[1] = 'n'; break;
+	case '\r': escaped[1] = 'r'; break;
+	case '\t': escaped[1] = 't'; break;
+	default:
+		escaped[1] = 'u';
+		escaped[4] = hexDigits[c >> 4];
+		escaped[5] = hexDigits[c & 0xF];
+		len = 6;
+	}
+
+	if (out) {
+		memcpy(out, escaped, len);
+	}
+	return len;
+}
+
+static u32 htmlEscapeMask(const u8* ptr) {
+	return Simd::equalMask(ptr, '&') | Simd::equalMask(ptr, '<') | Simd::equalMask(ptr, '>') | Simd::equalMask(ptr, '"') | Simd::equalMask(ptr, '\'');
+}
+
+static u64 escapeHtmlByte(u8 c, u8* out) {
+	const char* entity = "&#39;";
+	switch (c) {
+	case '&': entity = "&amp;"; break;
+	case '<': entity = "&lt;"; break;
+	case '>': entity = "&gt;"; break;
+	case '"': entity = "&quot;"; break;
+	}
+
+	auto len = strlen(entity);
+	if (out) {
+		memcpy(out, entity, len);
+	}
+	return len;
+}
+
+template<typename FMask, typename FEscape>
+void String::appendEscaped(const String& s, FMask&& needsEscape, FEscape&& escape) {
+	// Growing the buffer would free the text that is escaped
+	if (&s == this) {
+		String copy = s;
+		appendEscaped(copy, needsEscape, escape);
+		return;
+	}
+
+	if (s.isEmpty()) {
+		return;
+	}
+
+	auto ptr = s.safeBufferPointer();
+	auto numSourceBytes = s.bufferSize() - 1;
+	auto numBytes = escapeText(ptr, numSourceBytes, nullptr, needsEscape, escape);
+
+	auto used = bufferSize();
+	if (isSmall() && used + numBytes <= TSmallCapacity) {
+		escapeText(ptr, numSourceBytes, data.bytes + used - 1, needsEscape, escape);
+		data.bytes[TSmallCapacity - 1] = (u8)(TSmallCapacity - used - numBytes);
+		data.bytes[used + numBytes - 1] = '\0';
+		return;
+	}
+
+	// The escapes are ASCII, so every added byte is an added code point
+	auto hasKnownLength = (isSmall() || hasCachedCodePointsLitOrDyn()) && (s.isSmall() || s.hasCachedCodePointsLitOrDyn());
+	auto newCodePoints = hasKnownLength ? length() + s.length() + numBytes - numSourceBytes : 0;
+
+	ensureOwnedCapacity(used + numBytes);
+	escapeText(ptr, numSourceBytes, dynBufferPointer() + used - 1, needsEscape, escape);
+	dynBufferPointer()[used + numBytes - 1] = '\0';
+	dyn().used = used + numBytes;
+	dyn().setCodePoints(newCodePoints);
+}
+
+String& String::appendJsonEscaped(const String& s) {
+	appendEscaped(s, jsonEscapeMask, escapeJsonByte);
+	return *this;
+}
+
+String& String::appendHtmlEscaped(const String& s) {
+	appendEscaped(s, htmlEscapeMask, escapeHtmlByte);
+	return *this;
+}
+
+template<typename T>
+static std::optional<T> parseNumber(const char* ptr, u64 length) {
+	T value;
+	auto result = std::from_chars(ptr, ptr + length, value);
+	if (result.ec != std::errc() || result.ptr != ptr + length) {
+		return {};
+	}
+	return value;
+}
+
+std::optional<i64> String::toInt() const {
+	return parseNumber<i64>(cString(), bufferSize() - 1);
+}
+
+std::optional<double> String::toDouble() const {
+	return parseNumber<double>(cString(), bufferSize() - 1);
+}
+
 void String::setCharAt(u64 idx, Character c) {
 	auto used = bufferSize();
 	auto bufferPtr = safeBufferPointer();
@@ -416,3 +1379,184 @@ void String::setCharAt(u64 idx, Character c) {
 		memmove(posPtr + newCharSize, posPtr + oldCharSize, used - (posPtr - bufferPtr) - oldCharSize);
 	}
 }
+
+String& String::prepend(const String& s) {
+	if (s.isEmpty()) {
+		return *this;
+	}
+
+	u64 newCodePoints = 0;
+	// Same as for appending: Either one is small and the other one has a cached
+	// codePoint count or both have a cached code point count
+	if ((s.isSmall() && hasCachedCodePointsLitOrDyn()) ||
+		(s.hasCachedCodePointsLitOrDyn() && isSmall()) ||
+		(s.hasCachedCodePointsLitOrDyn() && hasCachedCodePointsLitOrDyn())) {
+		newCodePoints = length() + s.length();
+		resetCodePointsLitOrDyn();
+	}
+
+	prependBytes((const u8*)s.cString(), s.bufferSize() - 1);
+
+	if (!isSmall()) {
+		dyn().setCodePoints(newCodePoints);
+	}
+
+	return *this;
+}
+
+String& String::prepend(const char* s) {
+	u64 numBytes;
+	u64 numCodePoints = Character::countCodePointsInCString(s, &numBytes);
+	if (!numBytes) {
+		return *this;
+	}
+
+	u64 newCodePoints = 0;
+	if (hasCachedCodePointsLitOrDyn() ||
+		(isSmall() && (bufferSize() + numBytes) > TSmallCapacity)) {
+		newCodePoints = length() + numCodePoints;
+		resetCodePointsLitOrDyn();
+	}
+
+	prependBytes((const u8*)s, numBytes);
+
+	if (!isSmall()) {
+		dyn().setCodePoints(newCodePoints);
+	}
+
+	return *this;
+}
+
+void String::removePrefix(u64 numCodePoints) {
+	if (!numCodePoints || isEmpty()) {
+		return;
+	}
+
+	// Find the first byte that is kept. Removing more code points than
+	// there are, just removes everything
+	auto used = bufferSize();
+	auto bufferPtr = safeBufferPointer();
+	auto posPtr = Character::getCodePointInBufferAt(bufferPtr, used - 1, numCodePoints);
+	auto numBytes = posPtr ? (u64)(posPtr - bufferPtr) : used - 1;
+
+	if (isSmall()) {
+		// Move the remaining bytes and the null byte to the front
+		memmove(data.bytes, data.bytes + numBytes, used - numBytes);
+		data.bytes[TSmallCapacity - 1] = (TSmallCapacity - used + numBytes);
+		data.bytes[used - numBytes - 1] = '\0';
+		return;
+	}
+
+	// The cached count is adjusted by the known number of removed code points
+	u64 newCodePoints = 0;
+	if (posPtr && hasCachedCodePointsLitOrDyn()) {
+		newCodePoints = length() - numCodePoints;
+	}
+
+	if (isLiteral()) {
+		lit().buffer() += numBytes;
+		lit().used -= numBytes;
+		lit().setCodePoints(newCodePoints);
+		return;
+	}
+
+	// The buffer is not written, so a shared string does not need to copy it
+	dyn().offset += numBytes;
+	dyn().used -= numBytes;
+	dyn().setCodePoints(newCodePoints);
+}
+
+static u32 whitespaceMask(const u8* ptr) {
+	return Simd::equalMask(ptr, ' ') | Simd::rangeMask(ptr, '\t', '\r');
+}
+
+static bool isWhitespace(u8 c) {
+	return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+static u64 countLeadingWhitespace(const u8* ptr, u64 length) {
+	u64 i = 0;
+	for (; length - i >= Simd::TGroupSize; i += Simd::TGroupSize) {
+		auto mask = whitespaceMask(ptr + i);
+		if (mask != 0xFFFF) {
+			return i + Simd::countTrailingZeros(~mask);
+		}
+	}
+
+	while (i < length && isWhitespace(ptr[i])) {
+		i++;
+	}
+	return i;
+}
+
+static u64 countTrailingWhitespace(const u8* ptr, u64 length) {
+	// Whole groups are skipped from the back, the rest is counted byte by byte
+	u64 count = 0;
+	while (length - count >= Simd::TGroupSize && whitespaceMask(ptr + length - count - Simd::TGroupSize) == 0xFFFF) {
+		count += Simd::TGroupSize;
+	}
+
+	while (count < length && isWhitespace(ptr[length - count - 1])) {
+		count++;
+	}
+	return count;
+}
+
+void String::removeBytes(u64 numFront, u64 numBack) {
+	if (!numFront && !numBack) {
+		return;
+	}
+
+	auto used = bufferSize();
+	auto newUsed = used - numFront - numBack;
+	if (isSmall()) {
+		memmove(data.bytes, data.bytes + numFront, newUsed - 1);
+		data.bytes[TSmallCapacity - 1] = (u8)(TSmallCapacity - newUsed);
+		data.bytes[newUsed - 1] = '\0';
+		return;
+	}
+
+	// Only ASCII is removed, so the cached count is adjusted by the number of bytes
+	u64 newCodePoints = hasCachedCodePointsLitOrDyn() ? length() - numFront - numBack : 0;
+
+	// Other strings may still see the bytes behind the new end
+	if (numBack && !isOwned()) {
+		String trimmed;
+		memcpy(trimmed.initAsUninitialized(newUsed, newCodePoints), safeBufferPointer() + numFront, newUsed - 1);
+		*this = std::move(trimmed);
+		return;
+	}
+
+	if (isLiteral()) {
+		lit().buffer() += numFront;
+		lit().used = newUsed;
+		lit().setCodePoints(newCodePoints);
+		return;
+	}
+
+	if (numBack) {
+		dropBufferAttachment();
+	}
+	dyn().offset += numFront;
+	dyn().used = newUsed;
+	dynBufferPointer()[newUsed - 1] = '\0';
+	dyn().setCodePoints(newCodePoints);
+}
+
+String& String::trim() {
+	auto ptr = safeBufferPointer();
+	auto length = isEmpty() ? 0 : bufferSize() - 1;
+	auto numFront = countLeadingWhitespace(ptr, length);
+	removeBytes(numFront, countTrailingWhitespace(ptr + numFront, length - numFront));
+	return *this;
+}
+
+String& String::trimStart() {
+	removeBytes(countLeadingWhitespace(safeBufferPointer(), isEmpty() ? 0 : bufferSize() - 1), 0);
+	return *this;
+}
+
+String& String::trimEnd() {
+	removeBytes(0, countTrailingWhitespace(safeBufferPointer(), isEmpty() ? 0 : bufferSize() - 1));
+	return *this;
+}
@@ -6,28 +6,63 @@
 
 #include "mem.h"
 #include "character.h"
+#include "hash.h"
 #include <optional>
+#include <charconv>
+#include <type_traits>
+#include <vector>
+
+class StringView;
+
+template<u64 NumPieces, u64 NumArguments>
+class ParsedFormatString;
+
+// Arithmetic types that are formatted as numbers. Booleans and the character types hold no
+// numbers, but signed and unsigned char are the 8 bit integers
+template<typename T>
+constexpr bool isNumberType = std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+	!std::is_same_v<T, char> && !std::is_same_v<T, wchar_t> &&
+	!std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>
+#ifdef __cpp_char8_t
+	&& !std::is_same_v<T, char8_t>
+#endif
+	;
 
 class String {
 private:
 	struct StringDataInterface {
+		// The two bits below the mode bits remember that the text is known to be normalized
+		static constexpr u64 TKnownNFC = 1ull << 61;
+		static constexpr u64 TKnownNFD = 1ull << 60;
+
+		// Setting the code points means that the text was changed, which also forgets
+		// that it is normalized
 		void setCodePoints(u64 v) const {
 			u64 mask = 3ull << 62;
 			u64 topbits = codePoints & mask;
-			codePoints = (v & ~mask) | topbits; // Ensure top bits are unchanged to mark 'data' union as dynamic string
+			codePoints = (v & ~(15ull << 60)) | topbits; // Ensure top bits are unchanged to mark 'data' union as dynamic string
 		}
 
 		u64 getCodePoints() const {
-			return codePoints & ~(3ull << 62); // Hide top bits
+			return codePoints & ~(15ull << 60); // Hide top bits
+		}
+
+		// Caches the count of unchanged text, which keeps the other cached bits
+		void cacheCodePoints(u64 v) const {
+			codePoints = (codePoints & (15ull << 60)) | v;
 		}
 
+		bool isKnownNormalized(u64 form) const { return codePoints & form; }
+		void setKnownNormalized(u64 form) const { codePoints |= form; }
+		void forgetNormalization() const { codePoints &= ~(TKnownNFC | TKnownNFD); }
+
 		bool hasCachedCodePoints() const {
 			return getCodePoints() || used <= 1;
 		}
 
 		std::aligned_storage<8, 8> bufferPlaceHolder;
 
-		u64 capacity;
+		u64 offset; // Start of the text in the buffer, the bytes in front of it are headroom
 		u64 used;
 	protected:
 		mutable u64 codePoints; // Marked as dirty if codePoints == 0 && used > 1 (more than '\0' is stored)
@@ -39,12 +74,12 @@ private:
 		StringDataBase() { new(&bufferPlaceHolder) TBuffer(); }
 
 		StringDataBase(const StringDataBase& o)
-			: capacity(o.capacity), used(o.used), codePoints(o.codePoints) {
+			: offset(o.offset), used(o.used), codePoints(o.codePoints) {
 			new(&bufferPlaceHolder) TBuffer(o.buffer());
 		}
 
 		StringDataBase(StringDataBase&& o)
-			: capacity(o.capacity), used(o.used), codePoints(o.codePoints) {
+			: offset(o.offset), used(o.used), codePoints(o.codePoints) {
 			new(&bufferPlaceHolder) TBuffer(std::move(o.buffer()));
 		}
 
@@ -53,7 +88,7 @@ private:
 		}
 
 		StringDataBase& operator=(const StringDataBase& o) {
-			capacity = o.capacity;
+			offset = o.offset;
 			used = o.used;
 			codePoints = o.codePoints;
 			buffer() = o.buffer();
@@ -69,6 +104,9 @@ private:
 
 	static constexpr u64 TSmallCapacity = sizeof(TDynamicString);
 
+	// Buffers of at least this size are mapped from the OS, so they can grow without copying
+	static constexpr u64 THugeCapacity = 4 * 1024 * 1024;
+
 	union TData {
 		u8 bytes[TSmallCapacity];
 
@@ -83,7 +121,8 @@ private:
 		Small,
 		Shared,
 		Owned,
-		Literal
+		Literal,
+		File
 	};
 
 	bool isSmall() const {
@@ -102,6 +141,15 @@ private:
 		return isDynamic() && dyn().buffer().refCount() > 1;
 	}
 
+	bool isFileBacked() const {
+		return isDynamic() && dyn().buffer() && dyn().buffer().ptr()->isReadOnly();
+	}
+
+	// Only an owned buffer may be written to directly
+	bool isOwned() const {
+		return isDynamic() && !isShared() && !isFileBacked();
+	}
+
 
 	Mode mode() const;
 	void setMode(Mode m);
@@ -134,9 +182,13 @@ private:
 	void initAsSmallString(const u8* ptr, u64 len);
 	void initAsSmallString();
 	void initAsLiteralString(const char* s, u64 len);
+	void initAsSharedSlice(const SharedPtr<Shared<u8[]>>& buffer, u64 offset, u64 len);
 
 	const u8* safeBufferPointer() const;
 
+	u8* dynBufferPointer() { return dyn().buffer().dataPtr() + dyn().offset; }
+	const u8* dynBufferPointer() const { return dyn().buffer().dataPtr() + dyn().offset; }
+
 	bool hasCachedCodePointsLitOrDyn() const;
 	void resetCodePointsLitOrDyn();
 
@@ -144,11 +196,90 @@ private:
 		return Character::countCodePointsInBuffer(safeBufferPointer(), bufferSize() - 1);
 	}
 
+	static OwnPtr<Shared<u8[]>> allocateBuffer(u64 numBytes);
+
 	void ensureOwnedCapacity(u64 numBytes);
 	void growIntoDynamicString(u64 numBytes);
 	void appendBytes(const u8* bytes, u64 numBytes);
+	void prependBytes(const u8* bytes, u64 numBytes);
+
+	void changeCase(bool upper);
+
+	const StringDataInterface* normalizationCache() const;
+	String normalized(u64 form) const;
+	bool checkNormalized(u64 form) const;
+	void normalize(u64 form);
+
+	void removeBytes(u64 numFront, u64 numBack);
+
+	// Drops what was derived from the contents of the owned buffer before it is written
+	void dropBufferAttachment() {
+		if (isDynamic() && dyn().buffer()) {
+			dyn().buffer().ptr()->dropAttachment();
+		}
+	}
+
+	// Starts of the lines after the first one as offsets into the buffer, which are either
+	// taken from the index kept with the buffer or scanned into 'scratch'
+	struct LineStarts {
+		const u64* first;
+		const u64* last;
+		u64 base;
+
+		u64 count() const { return (u64)(last - first) + 1; }
+		u64 at(u64 idx) const { return idx ? first[idx - 1] - base : 0; }
+	};
+
+	LineStarts lineStarts(std::vector<u64>& scratch) const;
+
+	// Appends the text with the bytes selected by the mask function replaced by the escape
+	// function (see string.cpp)
+	template<typename FMask, typename FEscape>
+	void appendEscaped(const String& s, FMask&& needsEscape, FEscape&& escape);
+
+	// Makes an empty string hold numBytes (including the null byte) of uninitialized text with a
+	// known code point count, and returns where the text has to be written to
+	u8* initAsUninitialized(u64 numBytes, u64 numCodePoints);
+
+	// Lets the function write at most maxBytes ASCII characters right behind the string:
+	// Into the small string if they fit, otherwise into the owned tail. The function gets
+	// the range it may write to and returns the end of the written characters, or nullptr
+	// if they did not fit. The code point count just grows by the number of characters
+	template<typename F>
+	void appendAscii(u64 maxBytes, F&& write) {
+		auto used = bufferSize();
+		if (isSmall()) {
+			auto begin = (char*)data.bytes;
+			if (auto end = write(begin + used - 1, begin + TSmallCapacity - 1)) {
+				auto newUsed = (u64)(end - begin) + 1;
+				data.bytes[TSmallCapacity - 1] = (u8)(TSmallCapacity - newUsed);
+				data.bytes[newUsed - 1] = '\0';
+				return;
+			}
+			data.bytes[used - 1] = '\0';
+		}
+
+		auto hasKnownLength = isSmall() || hasCachedCodePointsLitOrDyn();
+		auto codePoints = hasKnownLength ? length() : 0;
+		ensureOwnedCapacity(used + maxBytes);
+
+		auto ptr = (char*)dynBufferPointer() + used - 1;
+		auto end = write(ptr, ptr + maxBytes);
+		assert(end);
+		*end = '\0';
+		dyn().used = used + (end - ptr);
+		dyn().setCodePoints(hasKnownLength ? codePoints + (end - ptr) : 0);
+	}
 
 	friend class StringIntrospection;
+	friend class ChunkedString;
+	friend class LineReader;
+	friend class StringTable;
+	friend class StringVector;
+	friend class StringOutputBuffer;
+	friend class Transcode;
+	friend class BinaryText;
+	friend class Parallel;
 
 public:
 	class CharRef {
@@ -187,19 +318,82 @@ public:
 
 	~String();
 
+	String& operator=(const String& s);
+	String& operator=(String&& s);
+
+	// Maps a file into memory and references its contents without copying them. Writing
+	// to the string copies them into an owned buffer. Returns nothing if the file cannot be opened
+	static std::optional<String> fromFile(const char* path);
+
 	u64 bufferCapacity() const;
 	u64 bufferSize() const;
 	u64 length() const;
 
-	String& append(Character c) {
-		appendBytes(c.bytes(), c.byteCount());
-		return *this;
-	}
+	String& append(Character c);
 
 	String& append(const String& s);
 	String& append(String&& s);
 	String& append(const char* s);
 
+	// Numbers are formatted with std::to_chars, in the shortest form that parses back to the
+	// same value. Characters and booleans are not treated as numbers, while signed and unsigned
+	// char are (see isNumberType)
+	template<typename T, std::enable_if_t<isNumberType<T>, int> = 0>
+	String& append(T value) {
+		appendAscii(std::is_integral_v<T> ? 24 : 32, [value](char* first, char* last) {
+			auto result = std::to_chars(first, last, value);
+			return result.ec == std::errc() ? result.ptr : nullptr;
+		});
+		return *this;
+	}
+
+	static String fromInt(i64 value) {
+		String s;
+		s.append(value);
+		return s;
+	}
+
+	static String fromDouble(double value) {
+		String s;
+		s.append(value);
+		return s;
+	}
+
+	// Replaces the '{}' placeholders with the arguments. The size of the result is computed
+	// first, so it is written into a single buffer (see format.h). Placeholders without an
+	// argument are left empty and surplus arguments are ignored
+	template<typename... Args>
+	static String format(const FormatString& fmt, const Args&... args);
+
+	// Format string literal parsed by COW_FORMAT, whose argument count is checked at compile time
+	template<u64 NumPieces, u64 NumArguments, typename... Args>
+	static String format(const ParsedFormatString<NumPieces, NumArguments>& fmt, const Args&... args);
+
+	// Parses the whole string as a number with std::from_chars. Returns nothing if it is not
+	// a number or does not fit into the type
+	std::optional<i64> toInt() const;
+	std::optional<double> toDouble() const;
+
+	// Escape quotes, backslashes and control characters for JSON string values, or the
+	// characters with a special meaning in HTML as entities. The escaped size is computed
+	// first, so the text is written into the buffer in one go
+	String& appendJsonEscaped(const String& s);
+	String& appendHtmlEscaped(const String& s);
+
+	// Prepending writes into the headroom of owned dynamic strings if there is enough
+	String& prepend(const String& s);
+	String& prepend(const char* s);
+
+	// Removing a prefix of a dynamic or literal string only moves its start
+	void removePrefix(u64 numCodePoints);
+
+	// Remove ASCII whitespace. Small strings are changed in place and other ones move their
+	// start and end inside of their buffer. Only whitespace at the end of shared and literal
+	// text makes a copy, because the text has to stay null terminated
+	String& trim();
+	String& trimStart();
+	String& trimEnd();
+
 	Character charAt(u64 idx) const {
 		auto ptr = Character::getCodePointInBufferAt(safeBufferPointer(), bufferSize() - 1, idx);
 		assert(ptr);
@@ -219,8 +413,41 @@ public:
 		return bufferSize() <= 1;
 	}
 
+	u64 hash() const {
+		return Hash::ofBuffer(safeBufferPointer(), bufferSize() - 1);
+	}
+
+	// Lines are separated by '\n', so n line breaks make n + 1 lines. Dynamic strings index
+	// their line starts with a SIMD scan on the first call and keep the index with their
+	// buffer, where their copies and other slices of the buffer find it too. Writing to the
+	// buffer drops it. Small and literal text is scanned on every call. The views are valid
+	// until the text changes
+	u64 lineCount() const;
+	StringView lineAt(u64 idx) const;
+	u64 lineOfByte(u64 offset) const;
+
+	// Convert the case of letters with the simple case mappings of Character. Shared and
+	// literal text is only copied if a character actually changes
+	String& toLower();
+	String& toUpper();
+
+	// Compare and hash with case folded characters without creating a folded copy
+	bool equalsIgnoreCase(const String& s) const;
+	u64 hashIgnoreCase() const;
+
+	// Canonical normalization of all of Unicode (see Character::decomposeCodePoint). Normalized
+	// text keeps its buffer and is only scanned once, as the result is cached like the code
+	// point count. Broken UTF-8 sequences are kept as they are
+	String& toNFC();
+	String& toNFD();
+	bool isNFC() const;
+	bool isNFD() const;
+
+	bool operator==(const String& s) const;
+	bool operator!=(const String& s) const { return !(*this == s); }
+
 	void reserve(u64 numBytes= 0) {
-		if ((bufferCapacity() < numBytes) || (mode() == Mode::Shared) || (mode() == Mode::Literal)) {
+		if ((bufferCapacity() < numBytes) || (mode() == Mode::Shared) || (mode() == Mode::Literal) || (mode() == Mode::File)) {
 			ensureOwnedCapacity(numBytes);
 		}
 	}
@@ -240,6 +467,7 @@ public:
 		case Mode::Shared:	return "Shared";
 		case Mode::Small:	return "Small";
 		case Mode::Literal:	return "Literal";
+		case Mode::File:	return "File";
 		}
 	}
 
@@ -249,6 +477,9 @@ public:
 	bool isShared() const { return str.isShared(); }
 	bool isDynamic() const { return str.isDynamic(); }
 	bool isLiteral() const { return str.isLiteral(); }
+	bool hasCachedCodePoints() const { return str.hasCachedCodePointsLitOrDyn(); }
+	bool hasMappedBuffer() const { return str.isDynamic() && str.dyn().buffer() && str.dyn().buffer().ptr()->isMapped(); }
+	const SharedAttachment* bufferAttachment() const { return str.isDynamic() && str.dyn().buffer() ? str.dyn().buffer().ptr()->attachment() : nullptr; }
 
 	using DynString = String::TDynamicString;
 	const DynString& dynamicData() const { return str.dyn(); }
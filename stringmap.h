@@ -0,0 +1,265 @@
+#pragma once
+
+#include <utility>
+
+#include "string.h"
+#include "stringview.h"
+#include "simd.h"
+
+// Flat open addressing hash map with String keys, laid out like a Swiss table: The keys
+// and values live in a single array of slots, and a separate array holds one control byte
+// per slot with 7 bits of the key's hash (or the empty/deleted marker). A lookup compares
+// a whole group of 16 control bytes at once and only looks at the slots whose hash
+// fragment matches. Lookups by StringView and c-strings do not create a String
+template<typename V>
+class StringMap {
+private:
+	struct Slot {
+		String key;
+		V value;
+	};
+
+	static constexpr u8 TEmpty = 0x80;
+	static constexpr u8 TDeleted = 0xFE;
+	static constexpr u64 TGroupSize = Simd::TGroupSize;
+	static constexpr u64 TNotFound = ~0ull;
+
+	static u8 fragmentOf(u64 hash) { return hash & 0x7F; }
+
+	// Small string keys are compared inline, literal keys and slices by pointer first
+	static bool keyEquals(const String& key, const String& s) { return key == s; }
+	static bool keyEquals(const String& key, StringView v) { return StringView(key) == v; }
+
+	template<typename K>
+	u64 findIndex(const K& key, u64 hash) const {
+		if (!capacity) {
+			return TNotFound;
+		}
+
+		auto fragment = fragmentOf(hash);
+		auto groupMask = capacity / TGroupSize - 1;
+		auto group = (hash >> 7) & groupMask;
+		for (u64 step = 1;; step++) {
+			auto ctrl = control + group * TGroupSize;
+			for (auto matches = Simd::equalMask(ctrl, fragment); matches; matches &= matches - 1) {
+				auto idx = group * TGroupSize + Simd::countTrailingZeros(matches);
+				if (keyEquals(slots[idx].key, key)) {
+					return idx;
+				}
+			}
+
+			// An empty slot ends the probe sequence, deleted ones do not
+			if (Simd::equalMask(ctrl, TEmpty)) {
+				return TNotFound;
+			}
+
+			// Triangular probing visits every group, as their count is a power of two
+			group = (group + step) & groupMask;
+		}
+	}
+
+	u64 findFreeIndex(u64 hash) const {
+		auto groupMask = capacity / TGroupSize - 1;
+		auto group = (hash >> 7) & groupMask;
+		for (u64 step = 1;; step++) {
+			// Empty and deleted slots both have the high bit set
+			auto ctrl = control + group * TGroupSize;
+			if (auto free = Simd::highBitMask(ctrl)) {
+				return group * TGroupSize + Simd::countTrailingZeros(free);
+			}
+			group = (group + step) & groupMask;
+		}
+	}
+
+	void rehash(u64 newCapacity) {
+		auto oldControl = control;
+		auto oldSlots = slots;
+		auto oldCapacity = capacity;
+
+		allocate(newCapacity);
+		for (u64 i = 0; i != oldCapacity; i++) {
+			if (oldControl[i] & 0x80) {
+				continue;
+			}
+
+			auto hash = oldSlots[i].key.hash();
+			auto idx = findFreeIndex(hash);
+			control[idx] = fragmentOf(hash);
+			new(&slots[idx]) Slot{ std::move(oldSlots[i].key), std::move(oldSlots[i].value) };
+			oldSlots[i].~Slot();
+		}
+		numDeleted = 0;
+
+		if (oldSlots) {
+			Memory::freeAligned(oldSlots);
+		}
+	}
+
+	void allocate(u64 newCapacity) {
+		// The control bytes follow the slots in the same allocation
+		capacity = newCapacity;
+		auto mem = (u8*)Memory::allocateAligned(capacity * sizeof(Slot) + capacity, std::max<u64>(alignof(Slot), Memory::BufferAlignment));
+		slots = (Slot*)mem;
+		control = mem + capacity * sizeof(Slot);
+		memset(control, TEmpty, capacity);
+	}
+
+	void growIfFull() {
+		// Keep the load factor (including deleted slots) below 7/8, so probing always ends
+		if ((numItems + numDeleted + 1) * 8 <= capacity * 7) {
+			return;
+		}
+
+		// Only rehash in place if there are mostly deleted slots
+		auto newCapacity = capacity ? capacity : TGroupSize;
+		if ((numItems + 1) * 16 > capacity * 7) {
+			newCapacity = capacity ? capacity * 2 : TGroupSize;
+		}
+		rehash(newCapacity);
+	}
+
+	template<typename K>
+	u64 insertIndex(const K& key, u64 hash, bool& inserted) {
+		auto idx = findIndex(key, hash);
+		inserted = idx == TNotFound;
+		if (!inserted) {
+			return idx;
+		}
+
+		growIfFull();
+		idx = findFreeIndex(hash);
+		numDeleted -= control[idx] == TDeleted;
+		control[idx] = fragmentOf(hash);
+		numItems++;
+		return idx;
+	}
+
+	template<typename K>
+	bool eraseKey(const K& key, u64 hash) {
+		auto idx = findIndex(key, hash);
+		if (idx == TNotFound) {
+			return false;
+		}
+
+		slots[idx].~Slot();
+		control[idx] = TDeleted;
+		numItems--;
+		numDeleted++;
+		return true;
+	}
+
+	void destroy() {
+		clear();
+		if (slots) {
+			Memory::freeAligned(slots);
+		}
+	}
+
+	u8* control{ nullptr };
+	Slot* slots{ nullptr };
+	u64 capacity{ 0 };
+	u64 numItems{ 0 };
+	u64 numDeleted{ 0 };
+
+public:
+	StringMap() = default;
+	StringMap(const StringMap&) = delete;
+
+	StringMap(StringMap&& m)
+		: control(m.control), slots(m.slots), capacity(m.capacity), numItems(m.numItems), numDeleted(m.numDeleted) {
+		m.control = nullptr;
+		m.slots = nullptr;
+		m.capacity = m.numItems = m.numDeleted = 0;
+	}
+
+	StringMap& operator=(StringMap&& m) {
+		if (this != &m) {
+			this->~StringMap();
+			new(this) StringMap(std::move(m));
+		}
+		return *this;
+	}
+
+	~StringMap() { destroy(); }
+
+	u64 size() const { return numItems; }
+	bool isEmpty() const { return !numItems; }
+
+	void reserve(u64 numEntries) {
+		auto newCapacity = capacity ? capacity : TGroupSize;
+		while (numEntries * 8 > newCapacity * 7) {
+			newCapacity *= 2;
+		}
+
+		if (newCapacity > capacity) {
+			rehash(newCapacity);
+		}
+	}
+
+	V* find(const String& key) {
+		auto idx = findIndex(key, key.hash());
+		return idx != TNotFound ? &slots[idx].value : nullptr;
+	}
+
+	V* find(StringView key) {
+		auto idx = findIndex(key, key.hash());
+		return idx != TNotFound ? &slots[idx].value : nullptr;
+	}
+
+	V* find(const char* key) { return find(StringView(key)); }
+
+	const V* find(const String& key) const { return const_cast<StringMap*>(this)->find(key); }
+	const V* find(StringView key) const { return const_cast<StringMap*>(this)->find(key); }
+	const V* find(const char* key) const { return find(StringView(key)); }
+
+	bool contains(const String& key) const { return find(key); }
+	bool contains(StringView key) const { return find(key); }
+	bool contains(const char* key) const { return find(key); }
+
+	// Inserts the value or overwrites the existing one. Returns true if the key is new
+	bool insert(const String& key, V value) {
+		bool inserted;
+		auto idx = insertIndex(key, key.hash(), inserted);
+		if (inserted) {
+			new(&slots[idx]) Slot{ key, std::move(value) };
+		}
+		else {
+			slots[idx].value = std::move(value);
+		}
+		return inserted;
+	}
+
+	// Inserts a default constructed value if the key is new
+	V& operator[](const String& key) {
+		bool inserted;
+		auto idx = insertIndex(key, key.hash(), inserted);
+		if (inserted) {
+			new(&slots[idx]) Slot{ key, V() };
+		}
+		return slots[idx].value;
+	}
+
+	bool erase(const String& key) { return eraseKey(key, key.hash()); }
+	bool erase(StringView key) { return eraseKey(key, key.hash()); }
+	bool erase(const char* key) { return erase(StringView(key)); }
+
+	template<typename F>
+	void forEach(F&& func) const {
+		for (u64 i = 0; i != capacity; i++) {
+			if (!(control[i] & 0x80)) {
+				func(slots[i].key, slots[i].value);
+			}
+		}
+	}
+
+	void clear() {
+		for (u64 i = 0; i != capacity; i++) {
+			if (!(control[i] & 0x80)) {
+				slots[i].~Slot();
+			}
+			control[i] = TEmpty;
+		}
+		numItems = 0;
+		numDeleted = 0;
+	}
+};
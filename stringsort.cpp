@@ -0,0 +1,118 @@
+
+#include <atomic>
+#include <thread>
+
+#include "stringsort.h"
+
+// Smaller inputs are not worth starting threads for
+static constexpr u64 TParallelThreshold = 1 << 16;
+
+u64 StringSort::loadKey(const Item& item, u64 depth) {
+	// Big endian, so that comparing the keys compares the bytes. Missing bytes are zero,
+	// which sorts shorter strings first
+	u64 key = 0;
+	u64 cnt = depth < item.length ? std::min<u64>(8, item.length - depth) : 0;
+	for (u64 i = 0; i != cnt; i++) {
+		key |= (u64)item.ptr[depth + i] << (56 - 8 * i);
+	}
+	return key;
+}
+
+void StringSort::sortItems(Item* begin, Item* end, u64 depth, std::vector<std::pair<Item*, Item*>>* deferred) {
+	while (end - begin > 1) {
+		std::sort(begin, end, [](const Item& a, const Item& b) { return a.key < b.key; });
+
+		// Only groups of equal keys need to be sorted further. If the key ends with a zero
+		// byte all strings of the group end here and are equal
+		Item* largest = nullptr;
+		Item* largestEnd = nullptr;
+		for (auto runBegin = begin; runBegin != end;) {
+			auto runEnd = runBegin + 1;
+			while (runEnd != end && runEnd->key == runBegin->key) {
+				runEnd++;
+			}
+
+			if (runEnd - runBegin > 1 && (runBegin->key & 0xFF)) {
+				for (auto it = runBegin; it != runEnd; it++) {
+					it->key = loadKey(*it, depth + 8);
+				}
+
+				if (deferred) {
+					deferred->emplace_back(runBegin, runEnd);
+				}
+				else if (!largest || runEnd - runBegin > largestEnd - largest) {
+					// Recurse into the smaller groups and loop on the largest one
+					if (largest) {
+						sortItems(largest, largestEnd, depth + 8, nullptr);
+					}
+					largest = runBegin;
+					largestEnd = runEnd;
+				}
+				else {
+					sortItems(runBegin, runEnd, depth + 8, nullptr);
+				}
+			}
+
+			runBegin = runEnd;
+		}
+
+		if (!largest) {
+			return;
+		}
+
+		begin = largest;
+		end = largestEnd;
+		depth += 8;
+	}
+}
+
+void StringSort::sort(String* begin, String* end, bool parallel) {
+	u64 count = end - begin;
+	if (count < 2) {
+		return;
+	}
+
+	std::vector<Item> items(count);
+	for (u64 i = 0; i != count; i++) {
+		auto& item = items[i];
+		item.ptr = (const u8*)begin[i].cString();
+		item.length = begin[i].bufferSize() - 1;
+		item.index = i;
+		item.key = loadKey(item, 0);
+	}
+
+	auto threadCount = parallel && count >= TParallelThreshold ? std::thread::hardware_concurrency() : 1;
+	if (threadCount <= 1) {
+		sortItems(items.data(), items.data() + count, 0, nullptr);
+	}
+	else {
+		// The first level is sorted on this thread, the groups of equal keys below it are
+		// independent and taken by the threads one by one
+		std::vector<std::pair<Item*, Item*>> groups;
+		sortItems(items.data(), items.data() + count, 0, &groups);
+
+		std::atomic<u64> nextGroup{ 0 };
+		auto worker = [&] {
+			for (u64 idx; (idx = nextGroup++) < groups.size();) {
+				sortItems(groups[idx].first, groups[idx].second, 8, nullptr);
+			}
+		};
+
+		std::vector<std::thread> threads;
+		for (u64 i = 1; i < threadCount; i++) {
+			threads.emplace_back(worker);
+		}
+		worker();
+		for (auto& t : threads) {
+			t.join();
+		}
+	}
+
+	// Move the strings into their sorted order
+	std::vector<String> sorted;
+	sorted.reserve(count);
+	for (auto& item : items) {
+		sorted.push_back(std::move(begin[item.index]));
+	}
+	std::move(sorted.begin(), sorted.end(), begin);
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <vector>
+
+#include "string.h"
+
+// Sorts strings by their bytes, which is the same as code point order for valid UTF-8.
+// Every string is looked at once to cache its buffer pointer and the next 8 bytes as an
+// integer key. The keys are sorted instead of the strings, and only groups of strings
+// with equal keys are sorted further by their next 8 bytes (MSD radix sort with 8 byte
+// digits). The strings themselves are moved only once in the end
+class StringSort {
+public:
+	static void sort(String* begin, String* end, bool parallel = false);
+	static void sort(std::vector<String>& strings, bool parallel = false) {
+		sort(strings.data(), strings.data() + strings.size(), parallel);
+	}
+
+private:
+	struct Item {
+		u64 key;
+		const u8* ptr;
+		u64 length;
+		u64 index;
+	};
+
+	static u64 loadKey(const Item& item, u64 depth);
+	static void sortItems(Item* begin, Item* end, u64 depth, std::vector<std::pair<Item*, Item*>>* deferred);
+};
@@ -0,0 +1,119 @@
+
+#include <cstring>
+
+#include "stringstream.h"
+
+void StringOutputBuffer::attach() {
+	// The last byte of the free space is kept for the null byte
+	auto used = str->bufferSize();
+	if (str->isSmall()) {
+		auto begin = (char*)str->data.bytes;
+		setp(begin + used - 1, begin + String::TSmallCapacity - 1);
+		return;
+	}
+
+	str->ensureOwnedCapacity(used + 1);
+	auto begin = (char*)str->dynBufferPointer();
+	setp(begin + used - 1, begin + str->bufferCapacity() - 1);
+}
+
+void StringOutputBuffer::commit() {
+	auto end = pptr();
+	if (!end) {
+		return;
+	}
+	*end = '\0';
+
+	if (str->isSmall()) {
+		auto used = (u64)(end - (char*)str->data.bytes) + 1;
+		str->data.bytes[String::TSmallCapacity - 1] = (u8)(String::TSmallCapacity - used);
+		str->data.bytes[used - 1] = '\0';
+	}
+	else {
+		// The code point count is unknown now
+		str->dyn().used = (u64)(end - (char*)str->dynBufferPointer()) + 1;
+		str->resetCodePointsLitOrDyn();
+	}
+
+	// The string may be copied now, so its buffer might be shared by the next write. Writing
+	// attaches again, which makes sure the buffer is owned
+	setp(nullptr, nullptr);
+}
+
+void StringOutputBuffer::grow(u64 numBytes) {
+	// Grows into a dynamic string, which doubles its capacity
+	commit();
+	str->ensureOwnedCapacity(str->bufferSize() + numBytes);
+	attach();
+}
+
+StringOutputBuffer::int_type StringOutputBuffer::overflow(int_type c) {
+	if (traits_type::eq_int_type(c, traits_type::eof())) {
+		return traits_type::not_eof(c);
+	}
+
+	if (!pptr()) {
+		attach();
+	}
+	if (pptr() == epptr()) {
+		grow(1);
+	}
+	*pptr() = traits_type::to_char_type(c);
+	pbump(1);
+	return c;
+}
+
+std::streamsize StringOutputBuffer::xsputn(const char* s, std::streamsize n) {
+	if (!pptr()) {
+		attach();
+	}
+	if (epptr() - pptr() < n) {
+		grow((u64)n);
+	}
+
+	memcpy(pptr(), s, (size_t)n);
+	pbump((int)n);
+	return n;
+}
+
+int StringOutputBuffer::sync() {
+	commit();
+	return 0;
+}
+
+void StringInputBuffer::attach() {
+	auto begin = (char*)str.cString();
+	setg(begin, begin, begin + str.bufferSize() - 1);
+}
+
+void StringInputBuffer::reset(const String& s) {
+	str = s;
+	attach();
+}
+
+StringInputBuffer::pos_type StringInputBuffer::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) {
+	if (!(which & std::ios_base::in)) {
+		return pos_type(off_type(-1));
+	}
+
+	off_type base = dir == std::ios_base::beg ? 0 : dir == std::ios_base::cur ? gptr() - eback() : egptr() - eback();
+	auto pos = base + off;
+	if (pos < 0 || pos > egptr() - eback()) {
+		return pos_type(off_type(-1));
+	}
+
+	setg(eback(), eback() + pos, egptr());
+	return pos_type(pos);
+}
+
+StringInputBuffer::pos_type StringInputBuffer::seekpos(pos_type pos, std::ios_base::openmode which) {
+	return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+String StringOutputStream::take() {
+	buffer.pubsync();
+	auto s = std::move(string);
+	string = String();
+	buffer.reattach();
+	return s;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <istream>
+#include <ostream>
+#include <streambuf>
+
+#include "string.h"
+
+// Stream buffer whose put area is the free space right behind the text of a string: The
+// free bytes of a small string, or the owned tail of a dynamic buffer that grows as needed.
+// Written characters only become part of the string when the buffer is synced (flushed).
+// The string must not be used by anything else in between. After a sync the string may be
+// copied, the next write makes sure it owns its buffer again
+class StringOutputBuffer : public std::streambuf {
+public:
+	StringOutputBuffer(String& s) : str(&s) {}
+	StringOutputBuffer(const StringOutputBuffer&) = delete;
+	~StringOutputBuffer() { commit(); }
+
+	// Has to be called after the string was changed directly
+	void reattach() { setp(nullptr, nullptr); }
+
+protected:
+	int_type overflow(int_type c) override;
+	std::streamsize xsputn(const char* s, std::streamsize n) override;
+	int sync() override;
+
+private:
+	void attach();
+	void commit();
+	void grow(u64 numBytes);
+
+	String* str;
+};
+
+// Stream buffer reading the bytes of a string in any mode without copying them. It keeps a
+// reference to dynamic and literal buffers
+class StringInputBuffer : public std::streambuf {
+public:
+	StringInputBuffer(const String& s) : str(s) { attach(); }
+	StringInputBuffer(const StringInputBuffer&) = delete;
+
+	void reset(const String& s);
+
+protected:
+	pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override;
+	pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+
+private:
+	void attach();
+
+	String str;
+};
+
+// Output stream writing right into a string. It can be reused for many messages by
+// taking the finished string out of it
+class StringOutputStream : public std::ostream {
+public:
+	StringOutputStream() : std::ostream(nullptr), buffer(string) { rdbuf(&buffer); }
+
+	const String& str() {
+		buffer.pubsync();
+		return string;
+	}
+
+	// Moves the string out and starts a new empty one
+	String take();
+
+private:
+	String string;
+	StringOutputBuffer buffer;
+};
+
+class StringInputStream : public std::istream {
+public:
+	StringInputStream(const String& s) : std::istream(nullptr), buffer(s) { rdbuf(&buffer); }
+
+	// Starts reading another string and clears the error state
+	void reset(const String& s) {
+		buffer.reset(s);
+		clear();
+	}
+
+private:
+	StringInputBuffer buffer;
+};
@@ -0,0 +1,115 @@
+
+#include <cstdio>
+#include <cstring>
+
+#include "stringtable.h"
+
+static constexpr char tableMagic[8] = { 'C', 'O', 'W', 'S', 'T', 'A', 'B', '2' };
+
+bool StringTable::write(const char* path, const std::vector<String>& strings) {
+	auto file = fopen(path, "wb");
+	if (!file) {
+		return false;
+	}
+
+	std::vector<Entry> index;
+	index.reserve(strings.size());
+
+	// Write the payload after the header, and fill in the header at the end
+	static const u8 padding[8] = {};
+	u64 offset = sizeof(Header);
+	bool ok = !fseek(file, sizeof(Header), SEEK_SET);
+	for (auto& s : strings) {
+		auto used = s.bufferSize();
+		index.push_back({ offset, used, s.length(), s.hash() });
+
+		auto paddedUsed = (used + 7) & ~7ull;
+		ok = ok && fwrite(s.cString(), 1, used, file) == used;
+		ok = ok && fwrite(padding, 1, paddedUsed - used, file) == paddedUsed - used;
+		offset += paddedUsed;
+	}
+
+	ok = ok && fwrite(index.data(), sizeof(Entry), index.size(), file) == index.size();
+
+	Header header;
+	memcpy(header.magic, tableMagic, sizeof(tableMagic));
+	header.count = strings.size();
+	header.indexOffset = offset;
+	header.fileSize = offset + sizeof(Entry) * index.size();
+	header.indexHash = Hash::ofBuffer((const u8*)index.data(), sizeof(Entry) * index.size());
+	ok = ok && !fseek(file, 0, SEEK_SET);
+	ok = ok && fwrite(&header, sizeof(Header), 1, file) == 1;
+
+	return !fclose(file) && ok;
+}
+
+std::optional<StringTable> StringTable::load(const char* path) {
+	u64 size;
+	auto ptr = (const u8*)Memory::mapFile(path, 0, &size);
+	if (!ptr) {
+		return {};
+	}
+
+	StringTable table(ptr, size);
+	auto& header = table.header();
+	if (size < sizeof(Header) ||
+		memcmp(header.magic, tableMagic, sizeof(tableMagic)) ||
+		header.fileSize != size ||
+		header.indexOffset < sizeof(Header) ||
+		header.indexOffset > size ||
+		header.indexOffset % alignof(Entry) ||
+		(size - header.indexOffset) / sizeof(Entry) < header.count) {
+		return {};
+	}
+
+	// The precomputed code point counts are trusted, so the index has to be the one that was
+	// written. Only the index is read here, the payload pages stay untouched until used
+	auto entries = (const Entry*)(ptr + header.indexOffset);
+	if (Hash::ofBuffer((const u8*)entries, sizeof(Entry) * header.count) != header.indexHash) {
+		return {};
+	}
+
+	// Every entry has to stay inside the payload, following the previous one
+	u64 payloadEnd = sizeof(Header);
+	for (u64 i = 0; i != header.count; i++) {
+		auto& e = entries[i];
+		if (!e.used ||
+			e.offset < payloadEnd ||
+			e.offset > header.indexOffset ||
+			e.used > header.indexOffset - e.offset ||
+			e.codePoints > e.used - 1) {
+			return {};
+		}
+		payloadEnd = e.offset + e.used;
+	}
+
+	return table;
+}
+
+StringTable::~StringTable() {
+	if (base) {
+		Memory::unmapFile((void*)base, 0, fileSize);
+	}
+}
+
+const StringTable::Entry& StringTable::entry(u64 idx) const {
+	// The index was validated when the table was loaded
+	assert(idx < size());
+	auto& e = ((const Entry*)(base + header().indexOffset))[idx];
+	assert(e.used && e.offset + e.used <= header().indexOffset);
+	return e;
+}
+
+String StringTable::at(u64 idx) const {
+	// The string just references the mapped bytes and takes over the code point count. The
+	// terminator is only checked now, an entry whose payload was damaged comes back empty
+	auto& e = entry(idx);
+	String s;
+	if (base[e.offset + e.used - 1]) {
+		return s;
+	}
+
+	s.initAsLiteralString((const char*)base + e.offset, e.used);
+	s.lit().setCodePoints(e.codePoints);
+	return s;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <vector>
+
+#include "string.h"
+
+// Binary file of null-terminated strings with their precomputed byte lengths, code point
+// counts and hashes. Loading maps the file into memory and hands out literal mode strings
+// referencing it, which already know their length. Loading only checks the header and the
+// index against its checksum, the payload is not read until a string is taken out. The
+// strings must not outlive the table they were taken from (see literal strings)
+//
+// Layout (little endian):
+//   Header:  magic "COWSTAB2", u64 entry count, u64 index offset, u64 file size, u64 index hash
+//   Payload: the null-terminated bytes of all strings, padded to 8 bytes
+//   Index:   per entry u64 offset, u64 bytes incl. null byte, u64 code points, u64 hash
+class StringTable {
+private:
+	struct Header {
+		char magic[8];
+		u64 count;
+		u64 indexOffset;
+		u64 fileSize;
+		u64 indexHash;
+	};
+
+	struct Entry {
+		u64 offset;
+		u64 used;
+		u64 codePoints;
+		u64 hash;
+	};
+
+	StringTable(const u8* ptr, u64 size) : base(ptr), fileSize(size) {}
+
+	const Header& header() const { return *(const Header*)base; }
+	const Entry& entry(u64 idx) const;
+
+	const u8* base{ nullptr };
+	u64 fileSize{ 0 };
+
+public:
+	static bool write(const char* path, const std::vector<String>& strings);
+	static std::optional<StringTable> load(const char* path);
+
+	StringTable(const StringTable&) = delete;
+	StringTable(StringTable&& t) : base(t.base), fileSize(t.fileSize) { t.base = nullptr; }
+	~StringTable();
+
+	u64 size() const { return header().count; }
+
+	String at(u64 idx) const;
+	u64 hashAt(u64 idx) const { return entry(idx).hash; }
+
+	String operator[](u64 idx) const { return at(idx); }
+};
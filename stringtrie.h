@@ -0,0 +1,263 @@
+#pragma once
+
+#include <optional>
+#include <utility>
+
+#include "string.h"
+#include "stringview.h"
+#include "simd.h"
+
+// Radix tree over the bytes of String keys for exact, prefix and longest prefix lookups.
+// Chains of single children are merged into one node, whose edge label references the
+// bytes of a key stored further down instead of copying them. Nodes adapt their size:
+// Up to 16 children are kept as a sorted byte list that is searched with a single SIMD
+// compare, more children are indexed directly by their byte. Keys cannot be removed, as
+// their bytes may be referenced by the labels of other nodes
+template<typename V>
+class StringTrie {
+private:
+	static constexpr u64 TSmallNodeSize = Simd::TGroupSize;
+
+	struct Entry {
+		String key;
+		V value;
+	};
+
+	struct Node {
+		const u8* label{ nullptr };
+		u64 labelLength{ 0 };
+		std::optional<Entry> entry;
+
+		// Sorted child bytes while there are at most 16 children, afterwards the
+		// children array has an entry for every byte value
+		u16 numChildren{ 0 };
+		u8 childBytes[TSmallNodeSize];
+		Node** children{ nullptr };
+
+		bool isFull() const { return numChildren > TSmallNodeSize; }
+
+		Node** childSlot(u8 byte) {
+			if (isFull()) {
+				return children[byte] ? &children[byte] : nullptr;
+			}
+
+			auto matches = Simd::equalMask(childBytes, byte) & ((1u << numChildren) - 1);
+			return matches ? &children[Simd::countTrailingZeros(matches)] : nullptr;
+		}
+
+		Node* child(u8 byte) {
+			auto slot = childSlot(byte);
+			return slot ? *slot : nullptr;
+		}
+
+		void addChild(u8 byte, Node* node) {
+			if (numChildren == TSmallNodeSize) {
+				// Grow into a node indexed by byte
+				auto full = new Node*[256]();
+				for (u64 i = 0; i != numChildren; i++) {
+					full[childBytes[i]] = children[i];
+				}
+				delete[] children;
+				children = full;
+			}
+
+			if (isFull() || numChildren == TSmallNodeSize) {
+				children[byte] = node;
+				numChildren++;
+				return;
+			}
+
+			if (!children) {
+				children = new Node*[TSmallNodeSize];
+			}
+
+			u64 idx = numChildren;
+			while (idx && childBytes[idx - 1] > byte) {
+				childBytes[idx] = childBytes[idx - 1];
+				children[idx] = children[idx - 1];
+				idx--;
+			}
+			childBytes[idx] = byte;
+			children[idx] = node;
+			numChildren++;
+		}
+
+		template<typename F>
+		void forEachChild(F&& func) const {
+			if (isFull()) {
+				for (u64 i = 0; i != 256; i++) {
+					if (children[i]) {
+						func(children[i]);
+					}
+				}
+				return;
+			}
+
+			for (u64 i = 0; i != numChildren; i++) {
+				func(children[i]);
+			}
+		}
+
+		~Node() {
+			forEachChild([](Node* c) { delete c; });
+			delete[] children;
+		}
+	};
+
+	static u64 commonPrefixLength(const u8* a, const u8* b, u64 length) {
+		u64 i = 0;
+		while (i < length && a[i] == b[i]) {
+			i++;
+		}
+		return i;
+	}
+
+	// Walks down as long as whole labels match, and returns the node where the key ends
+	const Node* findNode(StringView key) const {
+		auto node = &root;
+		auto ptr = key.data();
+		u64 left = key.byteCount();
+		while (left) {
+			auto child = const_cast<Node*>(node)->child(*ptr);
+			if (!child || child->labelLength > left || memcmp(child->label, ptr, child->labelLength)) {
+				return nullptr;
+			}
+
+			node = child;
+			ptr += child->labelLength;
+			left -= child->labelLength;
+		}
+		return node;
+	}
+
+	template<typename F>
+	static void forEachEntry(const Node* node, F& func) {
+		if (node->entry) {
+			func(node->entry->key, node->entry->value);
+		}
+		node->forEachChild([&](const Node* c) { forEachEntry(c, func); });
+	}
+
+	Node root;
+	u64 numEntries{ 0 };
+
+public:
+	StringTrie() = default;
+	StringTrie(const StringTrie&) = delete;
+
+	u64 size() const { return numEntries; }
+	bool isEmpty() const { return !numEntries; }
+
+	// Inserts the value or overwrites the existing one. Returns true if the key is new
+	bool insert(const String& key, V value) {
+		auto node = &root;
+		auto ptr = (const u8*)key.cString();
+		u64 length = key.bufferSize() - 1;
+		u64 pos = 0;
+
+		while (pos < length) {
+			auto slot = node->childSlot(ptr[pos]);
+			if (!slot) {
+				// The new leaf's label references the bytes of its own copy of the key,
+				// which shares the buffer of dynamic and literal strings
+				auto leaf = new Node();
+				leaf->entry.emplace(Entry{ key, std::move(value) });
+				leaf->label = (const u8*)leaf->entry->key.cString() + pos;
+				leaf->labelLength = length - pos;
+				node->addChild(ptr[pos], leaf);
+				numEntries++;
+				return true;
+			}
+
+			auto child = *slot;
+			auto common = commonPrefixLength(child->label, ptr + pos, std::min(child->labelLength, length - pos));
+			if (common < child->labelLength) {
+				// Split the label and put a new node in between
+				auto middle = new Node();
+				middle->label = child->label;
+				middle->labelLength = common;
+				child->label += common;
+				child->labelLength -= common;
+				middle->addChild(*child->label, child);
+				*slot = middle;
+				child = middle;
+			}
+
+			node = child;
+			pos += common;
+		}
+
+		if (node->entry) {
+			node->entry->value = std::move(value);
+			return false;
+		}
+
+		node->entry.emplace(Entry{ key, std::move(value) });
+		numEntries++;
+		return true;
+	}
+
+	V* find(StringView key) {
+		auto node = findNode(key);
+		return node && node->entry ? const_cast<V*>(&node->entry->value) : nullptr;
+	}
+
+	const V* find(StringView key) const { return const_cast<StringTrie*>(this)->find(key); }
+	bool contains(StringView key) const { return find(key); }
+
+	// Finds the longest key that is a prefix of the text, and optionally returns its byte length
+	V* longestPrefixOf(StringView text, u64* matchedBytes = nullptr) {
+		Node* node = &root;
+		Node* match = root.entry ? &root : nullptr;
+		u64 matchLength = 0;
+
+		auto ptr = text.data();
+		u64 left = text.byteCount();
+		u64 pos = 0;
+		while (left) {
+			auto child = node->child(ptr[pos]);
+			if (!child || child->labelLength > left || memcmp(child->label, ptr + pos, child->labelLength)) {
+				break;
+			}
+
+			node = child;
+			pos += child->labelLength;
+			left -= child->labelLength;
+			if (node->entry) {
+				match = node;
+				matchLength = pos;
+			}
+		}
+
+		if (matchedBytes) {
+			*matchedBytes = matchLength;
+		}
+		return match ? &match->entry->value : nullptr;
+	}
+
+	// Calls the function with every key starting with the prefix and its value in byte order
+	template<typename F>
+	void forEachWithPrefix(StringView prefix, F&& func) const {
+		auto node = &root;
+		auto ptr = prefix.data();
+		u64 left = prefix.byteCount();
+		while (left) {
+			auto child = const_cast<Node*>(node)->child(*ptr);
+			if (!child) {
+				return;
+			}
+
+			// The prefix may end inside of a label
+			auto cnt = std::min(child->labelLength, left);
+			if (memcmp(child->label, ptr, cnt)) {
+				return;
+			}
+
+			node = child;
+			ptr += cnt;
+			left -= cnt;
+		}
+
+		forEachEntry(node, func);
+	}
+};
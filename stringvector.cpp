@@ -0,0 +1,175 @@
+
+#include <cstring>
+
+#include "stringvector.h"
+
+StringVector::StringVector(bool cacheCodePoints, bool cacheHashes)
+	: cachesCodePoints(cacheCodePoints), cachesHashes(cacheHashes) {
+	// The end of the last string is stored as well, so the byte size of every element is known
+	offsets.push_back(0);
+}
+
+void StringVector::reserve(u64 numStrings, u64 numBytes) {
+	offsets.reserve(offsets.size() + numStrings);
+	if (cachesCodePoints) {
+		codePoints.reserve(codePoints.size() + numStrings);
+	}
+	if (cachesHashes) {
+		hashes.reserve(hashes.size() + numStrings);
+	}
+
+	ensureArenaCapacity(byteCount() + numBytes);
+}
+
+void StringVector::ensureArenaCapacity(u64 numBytes) {
+	if (numBytes <= arenaCapacity()) {
+		return;
+	}
+
+	auto newCapacity = std::max({ numBytes, arenaCapacity() * 2, TMinArenaCapacity });
+
+	// A huge arena no string references anymore is remapped in place
+	if (arena && arena.refCount() == 1 && arena.ptr()->isMapped()) {
+		arena = Shared<u8[]>::growMapped(arena.tryOwning(), newCapacity);
+		return;
+	}
+
+	// Strings taken from the vector keep the old arena alive
+	auto newArena = String::allocateBuffer(newCapacity);
+	if (byteCount()) {
+		memcpy(newArena.ptr()->value, arena.dataPtr(), byteCount());
+	}
+	arena = std::move(newArena);
+}
+
+void StringVector::pushEntry(const u8* ptr, u64 numBytes) {
+	// Only the bytes after all existing elements are written, which no string references
+	auto offset = byteCount();
+	ensureArenaCapacity(offset + numBytes + 1);
+	memcpy(arena.dataPtr() + offset, ptr, numBytes);
+	arena.dataPtr()[offset + numBytes] = '\0';
+	offsets.push_back(offset + numBytes + 1);
+
+	if (cachesCodePoints) {
+		codePoints.push_back(Character::countCodePointsInBuffer(ptr, numBytes));
+	}
+	if (cachesHashes) {
+		hashes.push_back(Hash::ofBuffer(ptr, numBytes));
+	}
+}
+
+StringVector& StringVector::append(StringView v) {
+	pushEntry(v.data(), v.byteCount());
+	return *this;
+}
+
+StringVector& StringVector::append(const StringVector& v) {
+	if (v.isEmpty()) {
+		return *this;
+	}
+
+	// Copy before growing, in case the vector is appended to itself
+	auto numStrings = v.size();
+	auto numBytes = v.byteCount();
+	auto base = byteCount();
+	std::vector<u64> otherOffsets(v.offsets.begin() + 1, v.offsets.end());
+	auto otherArena = v.arena;
+
+	reserve(numStrings, numBytes);
+	memcpy(arena.dataPtr() + base, otherArena.dataPtr(), numBytes);
+
+	for (auto offset : otherOffsets) {
+		offsets.push_back(base + offset);
+	}
+
+	// Take over the cached values, or compute them if the other vector does not cache them
+	for (u64 i = size() - numStrings; i < size(); i++) {
+		auto ptr = arena.dataPtr() + offsets[i];
+		if (cachesCodePoints) {
+			codePoints.push_back(v.cachesCodePoints
+				? v.codePoints[i - (size() - numStrings)]
+				: Character::countCodePointsInBuffer(ptr, usedAt(i) - 1));
+		}
+		if (cachesHashes) {
+			hashes.push_back(v.cachesHashes
+				? v.hashes[i - (size() - numStrings)]
+				: Hash::ofBuffer(ptr, usedAt(i) - 1));
+		}
+	}
+
+	return *this;
+}
+
+StringVector& StringVector::appendAll(const std::vector<String>& strings) {
+	// Grow once for all strings
+	u64 numBytes = 0;
+	for (auto& s : strings) {
+		numBytes += s.bufferSize();
+	}
+	reserve(strings.size(), numBytes);
+
+	for (auto& s : strings) {
+		append(s);
+	}
+
+	return *this;
+}
+
+String StringVector::at(u64 idx) const {
+	auto used = usedAt(idx);
+	auto ptr = (const char*)arena.dataPtr() + offsets[idx];
+
+	String s;
+	if (used <= String::TSmallCapacity) {
+		s = String(ptr, used);
+	}
+	else {
+		s.initAsSharedSlice(arena, offsets[idx], used);
+		if (cachesCodePoints) {
+			s.dyn().setCodePoints(codePoints[idx]);
+		}
+	}
+
+	return s;
+}
+
+StringView StringVector::viewAt(u64 idx) const {
+	return StringView(cStringAt(idx), usedAt(idx) - 1);
+}
+
+const char* StringVector::cStringAt(u64 idx) const {
+	assert(idx < size());
+	return (const char*)arena.dataPtr() + offsets[idx];
+}
+
+u64 StringVector::lengthAt(u64 idx) const {
+	if (cachesCodePoints) {
+		assert(idx < size());
+		return codePoints[idx];
+	}
+
+	return viewAt(idx).length();
+}
+
+u64 StringVector::hashAt(u64 idx) const {
+	if (cachesHashes) {
+		assert(idx < size());
+		return hashes[idx];
+	}
+
+	return viewAt(idx).hash();
+}
+
+void StringVector::clear() {
+	// Strings taken from the vector may still reference the arena -> start a new one
+	if (arena.refCount() > 1) {
+		arena = SharedPtr<Shared<u8[]>>();
+	}
+	else if (arena) {
+		arena.ptr()->dropAttachment();
+	}
+
+	offsets.resize(1);
+	codePoints.clear();
+	hashes.clear();
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <vector>
+
+#include "string.h"
+#include "stringview.h"
+
+// Sequence of many (small) strings stored back to back in a single growing arena buffer
+// instead of one object per string. Each string is kept with its null byte, so elements
+// can be handed out as views or as strings sharing the arena without copying the text.
+// Code point counts and hashes can optionally be cached per element when appending.
+// Elements cannot be changed in place, as strings taken from the vector may still
+// reference their bytes
+class StringVector {
+public:
+	static constexpr u64 TMinArenaCapacity = 4096;
+
+	StringVector(bool cacheCodePoints = false, bool cacheHashes = false);
+
+	u64 size() const { return offsets.size() - 1; }
+	u64 byteCount() const { return offsets.back(); }
+	bool isEmpty() const { return size() == 0; }
+
+	// Reserves space for more strings and bytes (including their null bytes)
+	void reserve(u64 numStrings, u64 numBytes);
+
+	StringVector& append(const String& s) { return append(StringView(s)); }
+	StringVector& append(const char* s) { return append(StringView(s)); }
+	StringVector& append(StringView v);
+
+	// Appends all strings of the other vector with a single copy of its arena
+	StringVector& append(const StringVector& v);
+	StringVector& appendAll(const std::vector<String>& strings);
+
+	// Short strings are returned as small strings, others reference the arena
+	String at(u64 idx) const;
+	StringView viewAt(u64 idx) const;
+	const char* cStringAt(u64 idx) const;
+
+	u64 lengthAt(u64 idx) const;
+	u64 hashAt(u64 idx) const;
+
+	String operator[](u64 idx) const { return at(idx); }
+
+	void clear();
+
+private:
+	u64 usedAt(u64 idx) const {
+		assert(idx < size());
+		return offsets[idx + 1] - offsets[idx];
+	}
+
+	u64 arenaCapacity() const { return arena ? arena.ptr()->size() : 0; }
+
+	void ensureArenaCapacity(u64 numBytes);
+	void pushEntry(const u8* ptr, u64 numBytes);
+
+	SharedPtr<Shared<u8[]>> arena;
+	std::vector<u64> offsets;
+	std::vector<u64> codePoints;
+	std::vector<u64> hashes;
+	bool cachesCodePoints;
+	bool cachesHashes;
+};
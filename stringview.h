@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstring>
+
+#include "string.h"
+
+// Non-owning reference to a range of UTF-8 encoded bytes, which is not necessarily
+// null-terminated. The referenced bytes need to outlive the view
+class StringView {
+public:
+	StringView() = default;
+	StringView(const char* ptr, u64 numBytes) : bytes((const u8*)ptr), numBytes(numBytes) {}
+	StringView(const char* s) : bytes((const u8*)s), numBytes(strlen(s)) {}
+	StringView(const String& s) : bytes((const u8*)s.cString()), numBytes(s.bufferSize() - 1) {}
+
+	const u8* data() const { return bytes; }
+	u64 byteCount() const { return numBytes; }
+	bool isEmpty() const { return !numBytes; }
+
+	u64 length() const {
+		return Character::countCodePointsInBuffer(bytes, numBytes);
+	}
+
+	u64 hash() const {
+		return Hash::ofBuffer(bytes, numBytes);
+	}
+
+	bool operator==(StringView v) const {
+		return numBytes == v.numBytes && (bytes == v.bytes || !memcmp(bytes, v.bytes, numBytes));
+	}
+
+	bool operator!=(StringView v) const { return !(*this == v); }
+
+private:
+	const u8* bytes{ (const u8*)"" };
+	u64 numBytes{ 0 };
+};
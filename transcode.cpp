@@ -0,0 +1,207 @@
+
+#include "transcode.h"
+#include "simd.h"
+
+// Decodes a non-ASCII code point and checks for truncated, overlong and surrogate sequences
+static bool decodeUtf8(const u8*& ptr, const u8* end, u32& codePoint) {
+	auto lead = *ptr;
+	u64 length;
+	u32 minCodePoint;
+	if (lead >= 0xC2 && lead <= 0xDF) {
+		length = 2;
+		codePoint = lead & 0x1F;
+		minCodePoint = 0x80;
+	}
+	else if (lead >= 0xE0 && lead <= 0xEF) {
+		length = 3;
+		codePoint = lead & 0x0F;
+		minCodePoint = 0x800;
+	}
+	else if (lead >= 0xF0 && lead <= 0xF4) {
+		length = 4;
+		codePoint = lead & 0x07;
+		minCodePoint = 0x10000;
+	}
+	else {
+		return false;
+	}
+
+	if ((u64)(end - ptr) < length) {
+		return false;
+	}
+
+	for (u64 i = 1; i != length; i++) {
+		if ((ptr[i] & 0xC0) != 0x80) {
+			return false;
+		}
+		codePoint = (codePoint << 6) | (ptr[i] & 0x3F);
+	}
+
+	if (codePoint < minCodePoint || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF)) {
+		return false;
+	}
+
+	ptr += length;
+	return true;
+}
+
+static u64 utf8ByteCount(u32 codePoint) {
+	return codePoint < 0x80 ? 1 : codePoint < 0x800 ? 2 : codePoint < 0x10000 ? 3 : 4;
+}
+
+static u8* encodeUtf8(u32 codePoint, u8* out) {
+	if (codePoint < 0x80) {
+		*out = (u8)codePoint;
+		return out + 1;
+	}
+
+	auto c = Character::fromCodePoint(codePoint);
+	memcpy(out, c.bytes(), c.byteCount());
+	return out + c.byteCount();
+}
+
+template<typename T>
+static std::optional<u64> decodeUtf8Buffer(const u8* ptr, u64 length, T* out) {
+	auto end = ptr + length;
+	auto begin = out;
+	while (ptr < end) {
+		if ((u64)(end - ptr) >= Simd::TGroupSize && !Simd::highBitMask(ptr)) {
+			Simd::widenAscii(ptr, out);
+			ptr += Simd::TGroupSize;
+			out += Simd::TGroupSize;
+			continue;
+		}
+
+		if (*ptr < 0x80) {
+			*out++ = *ptr++;
+			continue;
+		}
+
+		u32 codePoint;
+		if (!decodeUtf8(ptr, end, codePoint)) {
+			return {};
+		}
+
+		if constexpr (sizeof(T) == 2) {
+			if (codePoint >= 0x10000) {
+				codePoint -= 0x10000;
+				*out++ = (T)(0xD800 + (codePoint >> 10));
+				*out++ = (T)(0xDC00 + (codePoint & 0x3FF));
+				continue;
+			}
+		}
+		*out++ = (T)codePoint;
+	}
+
+	return out - begin;
+}
+
+std::optional<u64> Transcode::utf8ToUtf16(const u8* ptr, u64 length, char16_t* out) {
+	return decodeUtf8Buffer(ptr, length, out);
+}
+
+std::optional<u64> Transcode::utf8ToUtf32(const u8* ptr, u64 length, char32_t* out) {
+	return decodeUtf8Buffer(ptr, length, out);
+}
+
+bool Transcode::isValidUtf8(const u8* ptr, u64 length) {
+	auto end = ptr + length;
+	while (ptr < end) {
+		if ((u64)(end - ptr) >= Simd::TGroupSize && !Simd::highBitMask(ptr)) {
+			ptr += Simd::TGroupSize;
+			continue;
+		}
+
+		if (*ptr < 0x80) {
+			ptr++;
+			continue;
+		}
+
+		u32 codePoint;
+		if (!decodeUtf8(ptr, end, codePoint)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+std::optional<std::u16string> Transcode::toUtf16(const String& s) {
+	// Every code point takes one or two code units, but never more than it has bytes
+	auto numBytes = s.bufferSize() - 1;
+	std::u16string result;
+	result.resize(std::min(numBytes, 2 * s.length()));
+
+	auto cnt = utf8ToUtf16((const u8*)s.cString(), numBytes, result.data());
+	if (!cnt) {
+		return {};
+	}
+	result.resize(*cnt);
+	return result;
+}
+
+std::optional<std::u32string> Transcode::toUtf32(const String& s) {
+	std::u32string result;
+	result.resize(s.length());
+
+	auto cnt = utf8ToUtf32((const u8*)s.cString(), s.bufferSize() - 1, result.data());
+	if (!cnt) {
+		return {};
+	}
+	result.resize(*cnt);
+	return result;
+}
+
+std::optional<String> Transcode::fromUtf16(const char16_t* ptr, u64 length) {
+	// Validate and get the exact size first
+	u64 numBytes = 1;
+	u64 numCodePoints = 0;
+	for (u64 i = 0; i != length; i++, numCodePoints++) {
+		auto unit = ptr[i];
+		if (unit >= 0xD800 && unit <= 0xDFFF) {
+			if (unit > 0xDBFF || i + 1 == length || ptr[i + 1] < 0xDC00 || ptr[i + 1] > 0xDFFF) {
+				return {};
+			}
+			numBytes += 4;
+			i++;
+			continue;
+		}
+		numBytes += utf8ByteCount(unit);
+	}
+
+	String s;
+	auto out = s.initAsUninitialized(numBytes, numCodePoints);
+	for (u64 i = 0; i != length;) {
+		if (length - i >= Simd::TGroupSize && Simd::narrowAscii(ptr + i, out)) {
+			i += Simd::TGroupSize;
+			out += Simd::TGroupSize;
+			continue;
+		}
+
+		u32 codePoint = ptr[i++];
+		if (codePoint >= 0xD800 && codePoint <= 0xDBFF) {
+			codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (ptr[i++] - 0xDC00);
+		}
+		out = encodeUtf8(codePoint, out);
+	}
+
+	return s;
+}
+
+std::optional<String> Transcode::fromUtf32(const char32_t* ptr, u64 length) {
+	u64 numBytes = 1;
+	for (u64 i = 0; i != length; i++) {
+		auto codePoint = (u32)ptr[i];
+		if (codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF)) {
+			return {};
+		}
+		numBytes += utf8ByteCount(codePoint);
+	}
+
+	String s;
+	auto out = s.initAsUninitialized(numBytes, length);
+	for (u64 i = 0; i != length; i++) {
+		out = encodeUtf8((u32)ptr[i], out);
+	}
+
+	return s;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <string>
+
+#include "string.h"
+
+// Converts between UTF-8 strings and UTF-16 or UTF-32 text, validating the input on the
+// way. Runs of ASCII characters are converted 16 at a time. The size of the output is
+// computed up front, so it is allocated only once
+class Transcode {
+public:
+	// Write into caller provided buffers and return the number of written code units, or
+	// nothing if the input is not valid UTF-8. The buffer needs room for as many code units
+	// as the input has bytes (UTF-16) or code points (UTF-32)
+	static std::optional<u64> utf8ToUtf16(const u8* ptr, u64 length, char16_t* out);
+	static std::optional<u64> utf8ToUtf32(const u8* ptr, u64 length, char32_t* out);
+
+	// Checks the text like the conversions do, without writing anything
+	static bool isValidUtf8(const u8* ptr, u64 length);
+
+	static std::optional<std::u16string> toUtf16(const String& s);
+	static std::optional<std::u32string> toUtf32(const String& s);
+
+	// Return nothing for unpaired surrogates and invalid code points
+	static std::optional<String> fromUtf16(const char16_t* ptr, u64 length);
+	static std::optional<String> fromUtf32(const char32_t* ptr, u64 length);
+
+	static std::optional<String> fromUtf16(const std::u16string& s) { return fromUtf16(s.data(), s.size()); }
+	static std::optional<String> fromUtf32(const std::u32string& s) { return fromUtf32(s.data(), s.size()); }
+};